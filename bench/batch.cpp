@@ -0,0 +1,139 @@
+// throughput of cti::batch_interval against the scalar trait<double> code,
+// and a bit-for-bit comparison of both.
+//
+//     g++ -std=c++14 -O2 -mavx2 -ffp-contract=off -Iinclude bench/batch.cpp
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/batch.hpp>
+
+#include "bench.hpp"
+
+namespace{
+	constexpr std::size_t n = 1 << 20;
+
+	using kernel = void (*)(std::size_t, const double *, const double *, const double *, const double *, double *, double *);
+
+	void scalar_add(std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+	{
+		for(std::size_t i = 0; i < n; ++i){
+			inf[i] = cti::trait<double>::add_down(inf1[i], inf2[i]);
+			sup[i] = cti::trait<double>::add_up(sup1[i], sup2[i]);
+		}
+	}
+
+	void scalar_sub(std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+	{
+		for(std::size_t i = 0; i < n; ++i){
+			inf[i] = cti::trait<double>::sub_down(inf1[i], sup2[i]);
+			sup[i] = cti::trait<double>::sub_up(sup1[i], inf2[i]);
+		}
+	}
+
+	void scalar_mul(std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+	{
+		for(std::size_t i = 0; i < n; ++i){
+			auto r = cti::detail::interval_operator_mul_impl1(inf1[i], sup1[i], inf2[i], sup2[i]);
+			inf[i] = r.first;
+			sup[i] = r.second;
+		}
+	}
+
+	void scalar_div(std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+	{
+		for(std::size_t i = 0; i < n; ++i){
+			auto r = cti::detail::interval_operator_div_impl1(inf1[i], sup1[i], inf2[i], sup2[i]);
+			inf[i] = r.first;
+			sup[i] = r.second;
+		}
+	}
+
+	void scalar_sqrt(std::size_t n, const double *inf1, const double *sup1, const double *, const double *, double *inf, double *sup)
+	{
+		for(std::size_t i = 0; i < n; ++i){
+			inf[i] = cti::trait<double>::sqrt_down(inf1[i]);
+			sup[i] = cti::trait<double>::sqrt_up(sup1[i]);
+		}
+	}
+
+	void batch_sqrt(std::size_t n, const double *inf1, const double *sup1, const double *, const double *, double *inf, double *sup)
+	{
+		cti::detail::batch_sqrt(n, inf1, sup1, inf, sup);
+	}
+
+	// mixes ordinary values with zeros, infinities, subnormals and values
+	// close to the overflow threshold
+	void sprinkle(std::vector<double> &inf, std::vector<double> &sup, unsigned seed)
+	{
+		const double special[] = {
+			0.0, -0.0, 1e-310, -1e-310, 1e-300, 1e300, -1e300, 1.7e308, -1.7e308,
+			std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+		};
+
+		std::mt19937 engine(seed);
+
+		for(std::size_t i = 0; i < inf.size(); i += 7){
+			double a = special[engine() % (sizeof(special) / sizeof(*special))];
+			double b = engine() % 2 ? sup[i] : special[engine() % (sizeof(special) / sizeof(*special))];
+			inf[i] = a < b ? a : b;
+			sup[i] = a < b ? b : a;
+		}
+	}
+
+	void run(const char *name, kernel scalar, kernel batch,
+	         const std::vector<double> &inf1, const std::vector<double> &sup1,
+	         const std::vector<double> &inf2, const std::vector<double> &sup2)
+	{
+		std::vector<double> inf_s(n), sup_s(n), inf_b(n), sup_b(n);
+
+		double ts = bench::seconds([&]{
+			scalar(n, inf1.data(), sup1.data(), inf2.data(), sup2.data(), inf_s.data(), sup_s.data());
+			bench::do_not_optimize(inf_s);
+		});
+		double tb = bench::seconds([&]{
+			batch(n, inf1.data(), sup1.data(), inf2.data(), sup2.data(), inf_b.data(), sup_b.data());
+			bench::do_not_optimize(inf_b);
+		});
+
+		bench::report(name, "scalar", n, ts);
+		bench::report(name, "batch", n, tb);
+
+		std::size_t mismatch = 0;
+		for(std::size_t i = 0; i < n; ++i){
+			if(std::memcmp(&inf_s[i], &inf_b[i], sizeof(double)) != 0
+			|| std::memcmp(&sup_s[i], &sup_b[i], sizeof(double)) != 0)
+				++mismatch;
+		}
+		bench::report(name, "batch", "mismatches", static_cast<double>(mismatch));
+	}
+}
+
+int main()
+{
+	auto x = bench::random_intervals(n, -1e3, 1e3, 1);
+	auto y = bench::random_intervals(n, -1e3, 1e3, 2);
+	sprinkle(x.first, x.second, 3);
+	sprinkle(y.first, y.second, 4);
+
+	run("add", scalar_add, cti::detail::batch_add, x.first, x.second, y.first, y.second);
+	run("sub", scalar_sub, cti::detail::batch_sub, x.first, x.second, y.first, y.second);
+	run("mul", scalar_mul, cti::detail::batch_mul<>, x.first, x.second, y.first, y.second);
+
+	// divisors must not contain 0
+	auto d = bench::random_intervals(n, 1e-3, 1e3, 5);
+	for(std::size_t i = 0; i < n; i += 2){
+		double inf = d.first[i];
+		d.first[i] = -d.second[i];
+		d.second[i] = -inf;
+	}
+	run("div", scalar_div, cti::detail::batch_div, x.first, x.second, d.first, d.second);
+
+	auto s = bench::random_intervals(n, 0.0, 1e3, 6);
+	for(std::size_t i = 0; i < n; i += 5)
+		s.first[i] = 1e-310;
+	run("sqrt", scalar_sqrt, batch_sqrt, s.first, s.second, s.first, s.second);
+}
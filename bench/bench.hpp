@@ -0,0 +1,76 @@
+#pragma once
+
+// helpers shared by the runtime benchmarks in this directory.
+// every benchmark prints one JSON object per line so the output can be
+// collected with e.g. `./a.out > result.jsonl`.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace bench{
+	template <typename T>
+	inline void do_not_optimize(const T &x)
+	{
+#if defined(__GNUC__)
+		asm volatile("" : : "g"(&x) : "memory");
+#else
+		volatile auto p = &x;
+		(void)p;
+#endif
+	}
+
+	// best wall-clock time of `repeat` runs
+	template <typename F>
+	double seconds(F f, int repeat = 5)
+	{
+		double best = ::std::numeric_limits<double>::infinity();
+
+		for(int i = 0; i < repeat; ++i){
+			auto begin = ::std::chrono::steady_clock::now();
+			f();
+			auto end = ::std::chrono::steady_clock::now();
+
+			double t = ::std::chrono::duration<double>(end - begin).count();
+			if(t < best)
+				best = t;
+		}
+
+		return best;
+	}
+
+	inline void report(const char *benchmark, const char *variant, ::std::size_t ops, double seconds)
+	{
+		::std::printf(
+			"{\"benchmark\": \"%s\", \"variant\": \"%s\", \"ops\": %zu, \"seconds\": %.6e, \"ops_per_second\": %.6e}\n",
+			benchmark, variant, ops, seconds, ops / seconds);
+	}
+
+	inline void report(const char *benchmark, const char *variant, const char *key, double value)
+	{
+		::std::printf("{\"benchmark\": \"%s\", \"variant\": \"%s\", \"%s\": %.17g}\n",
+			benchmark, variant, key, value);
+	}
+
+	// n intervals whose endpoints are uniformly distributed in [lower, upper]
+	inline ::std::pair<::std::vector<double>, ::std::vector<double>>
+	random_intervals(::std::size_t n, double lower, double upper, unsigned seed = 1)
+	{
+		::std::mt19937_64 engine(seed);
+		::std::uniform_real_distribution<double> dist(lower, upper);
+
+		::std::vector<double> inf(n), sup(n);
+
+		for(::std::size_t i = 0; i < n; ++i){
+			double a = dist(engine), b = dist(engine);
+			inf[i] = a < b ? a : b;
+			sup[i] = a < b ? b : a;
+		}
+
+		return {::std::move(inf), ::std::move(sup)};
+	}
+}
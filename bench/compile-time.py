@@ -0,0 +1,371 @@
+#!/usr/bin/env python3
+"""Compile-time cost benchmark for cti::interval operator chains.
+
+Every operator on cti::interval produces a new interval<Inf, Sup> type, so the
+cost of a constant expression is paid by the compiler.  This script generates
+translation units in the style of sample/main.cpp that contain chains of depth
+10/100/1000 (sums, products and Horner polynomials), compiles each of them and
+reports wall-clock time, peak compiler memory, the total length of the
+mangled symbol names in the object file (when nm is available) and, when the
+compiler supports -ftime-trace (clang), the number of template instantiations
+per operator.
+
+With --lazy the same chains are evaluated through cti::lazy()/cti::eval()
+(cti/expr.hpp), which encodes only the final result.
+
+With --table the depth is the size of a table of enclosures of k/depth,
+written once as one interval<Inf, Sup> expression per entry ('entries') and
+once as a cti::table (cti/table.hpp, 'table').
+
+With --literal the depth is the number of digits of 20 decimal literals,
+parsed by the _di literal of cti/literals.hpp ('di'), by the former
+implementation that calls bcl::stod once per bound ('stod') and by the
+double-double _ddi literal of cti/dd.hpp ('ddi').
+
+Results are written as JSON, one record per (kind, depth) pair.
+
+	$ python3 bench/compile-time.py -I path/to/kv -I path/to/bcl -I path/to/sprout \\
+	      --compiler clang++ --output compile-time.json
+"""
+
+import argparse
+import collections
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+HEADER = """\
+#include <iostream>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/expr.hpp>
+
+int main()
+{
+	std::cout.setf(std::ios::scientific);
+	std::cout.precision(16);
+
+	cti::interval<D_T(0.1), D_T(0.9)> x;
+	cti::interval<D_T(-0.4), D_T(3.0)> y;
+	cti::interval<D_T(0.5), D_T(0.5)> c;
+
+"""
+
+FOOTER = """
+	std::cout << r << std::endl;
+}
+"""
+
+
+def chain_sum(depth):
+	# r = x + y + x + y + ...
+	terms = ['x' if i % 2 == 0 else 'y' for i in range(depth + 1)]
+	return ' + '.join(terms)
+
+
+def chain_product(depth):
+	# x is in [0.1, 0.9], so the product never overflows at depth 1000
+	return ' * '.join(['x'] * (depth + 1))
+
+
+def chain_horner(depth):
+	# r = (...((c * x + c) * x + c) * x ...) + c
+	expr = 'c'
+	for _ in range(depth):
+		expr = '({} * x + c)'.format(expr)
+	return expr
+
+
+KINDS = collections.OrderedDict([
+	('sum', chain_sum),
+	('product', chain_product),
+	('horner', chain_horner),
+])
+
+FIRST_OPERAND_RE = re.compile(r'\b[xyc]\b')
+
+
+def statement(expr, lazy):
+	if lazy:
+		# only the leftmost operand has to be lifted, the rest follows
+		expr = FIRST_OPERAND_RE.sub(r'cti::lazy(\g<0>)', expr, count=1)
+		expr = 'cti::eval({})'.format(expr)
+	return '\tauto r = ' + expr + ';\n'
+
+
+TABLE_HEADER = """\
+#include <cstddef>
+#include <iostream>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/rinterval.hpp>
+#include <cti/table.hpp>
+
+"""
+
+TABLE_FOOTER = """
+int main(int argc, char **)
+{
+	std::cout.precision(17);
+	std::cout << entries[argc] << std::endl;
+}
+"""
+
+
+def table_entries(size):
+	# one interval<Inf, Sup> type per entry
+	n = 'cti::interval<D_T({0}.0), D_T({0}.0)>{{}}'.format(size)
+	items = ['\tcti::interval<D_T({0}.0), D_T({0}.0)>{{}} / {1}'.format(k, n) for k in range(size)]
+	return ('const cti::rinterval<double> entries[] = {\n'
+	        + ',\n'.join(items) + '\n};\n')
+
+
+def table_generator(size):
+	return (
+		'struct ratio{{\n'
+		'\tconstexpr cti::rinterval<double> operator()(std::size_t k) const\n'
+		'\t{{\n'
+		'\t\treturn cti::rinterval<double>(static_cast<double>(k)) / {0}.0;\n'
+		'\t}}\n'
+		'}};\n'
+		'\n'
+		'constexpr const auto &entries = cti::table<{0}, ratio>::values;\n'
+	).format(size)
+
+
+TABLE_KINDS = collections.OrderedDict([
+	('entries', table_entries),
+	('table', table_generator),
+])
+
+
+LITERAL_HEADER = """\
+#include <iostream>
+
+#include <sprout/string.hpp>
+#include <bcl/string.hpp>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/literals.hpp>
+#include <cti/dd.hpp>
+
+using namespace cti::literals;
+
+// the literal before cti/decimal.hpp
+template <char ... Chars>
+constexpr auto operator "" _di_stod()
+{
+	constexpr auto str = ::sprout::make_string(Chars...);
+	constexpr double d1 = ::bcl::stod(str, nullptr, -1);
+	constexpr double d2 = ::bcl::stod(str, nullptr, 1);
+	return cti::interval<CTI_DOUBLE(d1), CTI_DOUBLE(d2)>{};
+}
+
+int main()
+{
+	std::cout.precision(17);
+"""
+
+LITERAL_FOOTER = """}
+"""
+
+LITERAL_COUNT = 20
+
+
+def literals(suffix, digits):
+	# k.dddd...e-5 with `digits` pseudo-random digits, all different
+	lines = []
+	for k in range(LITERAL_COUNT):
+		fraction = ''.join(str((k * 7 + i * i * 13 + i) % 10) for i in range(digits - 1))
+		lines.append('\tstd::cout << {}.{}e-5{} << std::endl;\n'.format(k % 9 + 1, fraction, suffix))
+	return ''.join(lines)
+
+
+LITERAL_KINDS = collections.OrderedDict([
+	('di', lambda digits: literals('_di', digits)),
+	('stod', lambda digits: literals('_di_stod', digits)),
+	('ddi', lambda digits: literals('_ddi', digits)),
+])
+
+
+OPERATOR_RE = re.compile(r'cti::operator(\+|-|\*|/|<=|>=|<|>|==|!=)')
+
+
+def count_instantiations(trace_path):
+	"""Counts InstantiateFunction/InstantiateClass events of a clang time trace."""
+	with open(trace_path) as f:
+		trace = json.load(f)
+
+	operators = collections.Counter()
+	intervals = 0
+	total = 0
+
+	for event in trace.get('traceEvents', []):
+		name = event.get('name')
+		if name not in ('InstantiateFunction', 'InstantiateClass'):
+			continue
+
+		total += 1
+		detail = event.get('args', {}).get('detail', '')
+
+		if name == 'InstantiateClass' and detail.startswith('cti::interval<'):
+			intervals += 1
+			continue
+
+		m = OPERATOR_RE.match(detail)
+		if m:
+			operators['operator' + m.group(1)] += 1
+
+	return {
+		'total': total,
+		'interval_types': intervals,
+		'per_operator': dict(operators),
+	}
+
+
+def symbol_bytes(obj):
+	"""Total length of the mangled symbol names defined in obj, or None."""
+	try:
+		out = subprocess.run(['nm', '--defined-only', obj], stdout=subprocess.PIPE,
+		                     stderr=subprocess.DEVNULL, check=True).stdout
+	except (OSError, subprocess.CalledProcessError):
+		return None
+
+	return sum(len(line.split()[-1]) for line in out.decode().splitlines() if line.strip())
+
+
+def compile_one(args, source, workdir):
+	src = os.path.join(workdir, 'chain.cpp')
+	obj = os.path.join(workdir, 'chain.o')
+
+	with open(src, 'w') as f:
+		f.write(source)
+
+	cmd = [args.compiler, '-std=c++14', '-c', src, '-o', obj,
+	       '-I', os.path.join(ROOT, 'include')]
+	cmd += ['-I' + d for d in args.include]
+	cmd += args.flag
+
+	if args.time_trace:
+		cmd.append('-ftime-trace')
+
+	# stderr goes to a file: a pipe that is not drained while waiting
+	# blocks the compiler once its diagnostics exceed the pipe buffer.
+	# wait4 is kept for the usage of this child alone, since ru_maxrss of
+	# RUSAGE_CHILDREN is the maximum over every compilation so far.
+	with tempfile.TemporaryFile(dir=workdir) as log:
+		begin = time.monotonic()
+		proc = subprocess.Popen(cmd, stderr=log)
+		_, status, usage = os.wait4(proc.pid, 0)
+		elapsed = time.monotonic() - begin
+
+		log.seek(0)
+		stderr = log.read().decode(errors='replace')
+
+	if os.waitstatus_to_exitcode(status) != 0:
+		sys.stderr.write(stderr)
+		raise RuntimeError('compilation failed: ' + ' '.join(cmd))
+
+	result = {
+		'seconds': elapsed,
+		# ru_maxrss is in kilobytes on Linux
+		'peak_rss_kb': usage.ru_maxrss,
+		'object_bytes': os.path.getsize(obj),
+		'symbol_bytes': symbol_bytes(obj),
+		'instantiations': None,
+	}
+
+	trace = os.path.join(workdir, 'chain.json')
+	if args.time_trace and os.path.exists(trace):
+		result['instantiations'] = count_instantiations(trace)
+
+	return result
+
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+	parser.add_argument('--compiler', default=os.environ.get('CXX', 'c++'))
+	parser.add_argument('-I', '--include', action='append', default=[],
+	                    help='include directory of kv, bcl, sprout or boost')
+	parser.add_argument('--flag', action='append', default=[],
+	                    help='extra compiler flag (repeatable)')
+	parser.add_argument('--depth', type=int, action='append',
+	                    help='chain depth (default: 10, 100, 1000)')
+	parser.add_argument('--kind', action='append', choices=list(KINDS),
+	                    help='chain kind (default: all)')
+	parser.add_argument('--repeat', type=int, default=1,
+	                    help='compile each source this many times and keep the fastest')
+	parser.add_argument('--time-trace', action='store_true',
+	                    help='pass -ftime-trace (clang) and count instantiations')
+	parser.add_argument('--lazy', action='store_true',
+	                    help='evaluate the chains through cti::lazy/cti::eval (cti/expr.hpp)')
+	parser.add_argument('--table', action='store_true',
+	                    help='compare a cti::table with one interval type per entry')
+	parser.add_argument('--literal', action='store_true',
+	                    help='compare the _di and _ddi literals with the bcl::stod one on long literals')
+	parser.add_argument('--output', help='write JSON here instead of stdout')
+	args = parser.parse_args()
+
+	depths = args.depth or [10, 100, 1000]
+	if args.table:
+		kinds = list(TABLE_KINDS)
+	elif args.literal:
+		kinds = list(LITERAL_KINDS)
+	else:
+		kinds = args.kind or list(KINDS)
+
+	records = []
+
+	with tempfile.TemporaryDirectory(prefix='cti-bench-') as workdir:
+		for kind in kinds:
+			for depth in depths:
+				if args.table:
+					source = TABLE_HEADER + TABLE_KINDS[kind](depth) + TABLE_FOOTER
+				elif args.literal:
+					source = LITERAL_HEADER + LITERAL_KINDS[kind](depth) + LITERAL_FOOTER
+				else:
+					source = HEADER + statement(KINDS[kind](depth), args.lazy) + FOOTER
+
+				runs = [compile_one(args, source, workdir) for _ in range(args.repeat)]
+				best = min(runs, key=lambda r: r['seconds'])
+				best['peak_rss_kb'] = max(r['peak_rss_kb'] for r in runs)
+
+				record = collections.OrderedDict([
+					('kind', kind),
+					('depth', depth),
+				])
+				record.update(best)
+				records.append(record)
+
+				sys.stderr.write('{:8} {:5d}  {:8.3f} s  {:8d} KiB\n'.format(
+					kind, depth, record['seconds'], record['peak_rss_kb']))
+
+	result = {
+		'compiler': args.compiler,
+		'flags': args.flag,
+		'lazy': args.lazy,
+		'table': args.table,
+		'literal': args.literal,
+		'results': records,
+	}
+
+	if args.output:
+		with open(args.output, 'w') as f:
+			json.dump(result, f, indent=1)
+			f.write('\n')
+	else:
+		json.dump(result, sys.stdout, indent=1)
+		sys.stdout.write('\n')
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,177 @@
+// intervals with double-double bounds: kv::interval<kv::dd> (rounding mode
+// switching), the scalar cti::rinterval<cti::dd> and the vectorized
+// cti::detail::ddbatch_* kernels.  `mismatches` counts the intervals where
+// the batch kernels differ from the scalar code, which must be 0.
+//
+//     g++ -std=c++14 -O2 -mavx2 -mfma -ffp-contract=off -Iinclude bench/dd.cpp
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <kv/interval.hpp>
+#include <kv/dd.hpp>
+#include <kv/rdd.hpp>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/dd.hpp>
+#include <cti/rinterval.hpp>
+#include <cti/ddbatch.hpp>
+
+#include "bench.hpp"
+
+namespace{
+	constexpr std::size_t n = 1 << 18;
+
+	using interval = cti::rinterval<cti::dd>;
+
+	struct intervals{
+		std::vector<double> inf_hi, inf_lo, sup_hi, sup_lo;
+
+		explicit intervals(std::size_t n)
+			: inf_hi(n), inf_lo(n), sup_hi(n), sup_lo(n)
+		{
+		}
+
+		cti::detail::ddbatch_arrays<const double> view() const
+		{
+			return {inf_hi.data(), inf_lo.data(), sup_hi.data(), sup_lo.data()};
+		}
+
+		cti::detail::ddbatch_arrays<double> view()
+		{
+			return {inf_hi.data(), inf_lo.data(), sup_hi.data(), sup_lo.data()};
+		}
+	};
+
+	// a nonzero trailing part below half an ulp of the leading part
+	cti::dd perturb(double x, std::mt19937_64 &engine)
+	{
+		std::uniform_real_distribution<double> dist(-std::ldexp(1.0, -54), std::ldexp(1.0, -54));
+		auto s = cti::trait<double>::twosum(x, x * dist(engine));
+		return {std::get<0>(s), std::get<1>(s)};
+	}
+
+	intervals random_intervals(double lower, double upper, unsigned seed)
+	{
+		auto x = bench::random_intervals(n, lower, upper, seed);
+		std::mt19937_64 engine(seed);
+
+		intervals y(n);
+		for(std::size_t i = 0; i < n; ++i){
+			cti::dd a = perturb(x.first[i], engine), b = perturb(x.second[i], engine);
+			if(b < a)
+				std::swap(a, b);
+
+			y.inf_hi[i] = a.hi;
+			y.inf_lo[i] = a.lo;
+			y.sup_hi[i] = b.hi;
+			y.sup_lo[i] = b.lo;
+		}
+		return y;
+	}
+
+	std::vector<interval> to_rinterval(const intervals &x)
+	{
+		auto v = x.view();
+		std::vector<interval> y(n);
+		for(std::size_t i = 0; i < n; ++i)
+			y[i] = interval(v.inf(i), v.sup(i));
+		return y;
+	}
+
+	std::vector<kv::interval<kv::dd>> to_kv(const std::vector<interval> &x)
+	{
+		std::vector<kv::interval<kv::dd>> y(n);
+		for(std::size_t i = 0; i < n; ++i)
+			y[i] = x[i].to_kv();
+		return y;
+	}
+
+	std::size_t mismatches(const std::vector<interval> &x, const intervals &y)
+	{
+		auto v = y.view();
+		std::size_t count = 0;
+		for(std::size_t i = 0; i < n; ++i){
+			if(x[i].lower() != v.inf(i) || x[i].upper() != v.sup(i))
+				++count;
+		}
+		return count;
+	}
+
+	template <typename KV, typename Scalar, typename Batch>
+	void run(const char *name, KV kv_op, Scalar scalar_op, Batch batch_op, const intervals &x, const intervals &y)
+	{
+		auto x_r = to_rinterval(x), y_r = to_rinterval(y);
+		auto x_kv = to_kv(x_r), y_kv = to_kv(y_r);
+
+		std::vector<kv::interval<kv::dd>> z_kv(n);
+		double t = bench::seconds([&]{
+			for(std::size_t i = 0; i < n; ++i)
+				z_kv[i] = kv_op(x_kv[i], y_kv[i]);
+			bench::do_not_optimize(z_kv);
+		});
+		bench::report(name, "kv_dd", n, t);
+
+		std::vector<interval> z_r(n);
+		t = bench::seconds([&]{
+			for(std::size_t i = 0; i < n; ++i)
+				z_r[i] = scalar_op(x_r[i], y_r[i]);
+			bench::do_not_optimize(z_r);
+		});
+		bench::report(name, "cti_scalar", n, t);
+
+		intervals z(n);
+		t = bench::seconds([&]{
+			batch_op(n, x.view(), y.view(), z.view());
+			bench::do_not_optimize(z.inf_hi);
+		});
+		bench::report(name, "cti_batch", n, t);
+		bench::report(name, "cti_batch", "mismatches", static_cast<double>(mismatches(z_r, z)));
+	}
+}
+
+int main()
+{
+	auto x = random_intervals(-1e3, 1e3, 1);
+	auto y = random_intervals(-1e3, 1e3, 2);
+
+	run("add",
+		[](const kv::interval<kv::dd> &a, const kv::interval<kv::dd> &b){ return a + b; },
+		[](const interval &a, const interval &b){ return a + b; },
+		cti::detail::ddbatch_add, x, y);
+
+	run("mul",
+		[](const kv::interval<kv::dd> &a, const kv::interval<kv::dd> &b){ return a * b; },
+		[](const interval &a, const interval &b){ return a * b; },
+		cti::detail::ddbatch_mul, x, y);
+
+	// divisors must not contain 0
+	auto d = random_intervals(1e-3, 1e3, 3);
+	for(std::size_t i = 0; i < n; i += 2){
+		std::swap(d.inf_hi[i], d.sup_hi[i]);
+		std::swap(d.inf_lo[i], d.sup_lo[i]);
+		d.inf_hi[i] = -d.inf_hi[i];
+		d.inf_lo[i] = -d.inf_lo[i];
+		d.sup_hi[i] = -d.sup_hi[i];
+		d.sup_lo[i] = -d.sup_lo[i];
+	}
+
+	run("div",
+		[](const kv::interval<kv::dd> &a, const kv::interval<kv::dd> &b){ return a / b; },
+		[](const interval &a, const interval &b){ return a / b; },
+		cti::detail::ddbatch_div, x, d);
+
+	auto s = random_intervals(0.0, 1e3, 4);
+
+	run("sqrt",
+		[](const kv::interval<kv::dd> &a, const kv::interval<kv::dd> &){ return sqrt(a); },
+		[](const interval &a, const interval &){
+			auto r = cti::detail::interval_sqrt_impl<cti::dd>(a.lower(), a.upper());
+			return interval(std::get<0>(r), std::get<1>(r));
+		},
+		[](std::size_t n, cti::detail::ddbatch_arrays<const double> a, cti::detail::ddbatch_arrays<const double>, cti::detail::ddbatch_arrays<double> z){
+			cti::detail::ddbatch_sqrt(n, a, z);
+		}, s, s);
+}
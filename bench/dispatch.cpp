@@ -0,0 +1,144 @@
+// static dispatch on the bounds of a cti::interval: y * x and y / x for a
+// compile-time interval x and runtime intervals y of random sign.  the
+// generic kernels run interval_operator_mul_impl1 and
+// interval_operator_div_impl1 with the bounds of x as runtime values; the
+// specialized kernels are selected by cti::certainly when x > 0 and skip
+// the sign tests on x and the check for division by 0.  `mismatches`
+// counts the results that differ from the generic kernel.
+//
+//     g++ -std=c++14 -O2 -ffp-contract=off -Iinclude bench/dispatch.cpp
+
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+
+#include "bench.hpp"
+
+namespace{
+	constexpr std::size_t n = 1 << 20;
+
+	using zero = CTI_DOUBLE(0.0);
+
+	struct arrays{
+		const double *inf1;
+		const double *sup1;
+		double *inf;
+		double *sup;
+	};
+
+	// any x: the bounds are hidden from the optimizer as they would be
+	// for a runtime value
+	template <typename X>
+	void mul(std::false_type, X x, arrays a)
+	{
+		double inf2 = x.lower(), sup2 = x.upper();
+		bench::do_not_optimize(inf2);
+		bench::do_not_optimize(sup2);
+
+		for(std::size_t i = 0; i < n; ++i){
+			auto r = cti::detail::interval_operator_mul_impl1(a.inf1[i], a.sup1[i], inf2, sup2);
+			a.inf[i] = r.first;
+			a.sup[i] = r.second;
+		}
+	}
+
+	// x > 0: the lower bound is inf1 times the lower or upper bound of x
+	// depending on the sign of inf1 alone, and likewise for the upper bound
+	template <typename X>
+	void mul(std::true_type, X, arrays a)
+	{
+		constexpr double inf2 = X{}.lower(), sup2 = X{}.upper();
+
+		for(std::size_t i = 0; i < n; ++i){
+			a.inf[i] = cti::trait<double>::mul_down(a.inf1[i], a.inf1[i] >= 0.0 ? inf2 : sup2);
+			a.sup[i] = cti::trait<double>::mul_up(a.sup1[i], a.sup1[i] >= 0.0 ? sup2 : inf2);
+		}
+	}
+
+	template <typename X>
+	void div(std::false_type, X x, arrays a)
+	{
+		double inf2 = x.lower(), sup2 = x.upper();
+		bench::do_not_optimize(inf2);
+		bench::do_not_optimize(sup2);
+
+		for(std::size_t i = 0; i < n; ++i){
+			auto r = cti::detail::interval_operator_div_impl1(a.inf1[i], a.sup1[i], inf2, sup2);
+			a.inf[i] = r.first;
+			a.sup[i] = r.second;
+		}
+	}
+
+	template <typename X>
+	void div(std::true_type, X, arrays a)
+	{
+		constexpr double inf2 = X{}.lower(), sup2 = X{}.upper();
+
+		for(std::size_t i = 0; i < n; ++i){
+			a.inf[i] = cti::trait<double>::div_down(a.inf1[i], a.inf1[i] >= 0.0 ? sup2 : inf2);
+			a.sup[i] = cti::trait<double>::div_up(a.sup1[i], a.sup1[i] > 0.0 ? inf2 : sup2);
+		}
+	}
+
+	std::size_t mismatches(const std::vector<double> &inf1, const std::vector<double> &sup1,
+	                       const std::vector<double> &inf2, const std::vector<double> &sup2)
+	{
+		std::size_t count = 0;
+		for(std::size_t i = 0; i < n; ++i){
+			if(inf1[i] != inf2[i] || sup1[i] != sup2[i])
+				++count;
+		}
+		return count;
+	}
+
+	template <typename Kernel, typename X>
+	void run(const char *name, Kernel kernel, X x, const std::pair<std::vector<double>, std::vector<double>> &y)
+	{
+		std::vector<double> inf_g(n), sup_g(n), inf_s(n), sup_s(n);
+		arrays generic{y.first.data(), y.second.data(), inf_g.data(), sup_g.data()};
+		arrays specialized{y.first.data(), y.second.data(), inf_s.data(), sup_s.data()};
+
+		double t = bench::seconds([&]{
+			kernel(std::false_type{}, x, generic);
+			bench::do_not_optimize(inf_g);
+		});
+		bench::report(name, "generic", n, t);
+
+		t = bench::seconds([&]{
+			kernel(cti::certainly<std::greater<>>(x, zero{}), x, specialized);
+			bench::do_not_optimize(inf_s);
+		});
+		bench::report(name, "specialized", n, t);
+		bench::report(name, "specialized", "mismatches", static_cast<double>(mismatches(inf_g, sup_g, inf_s, sup_s)));
+	}
+
+	struct mul_kernel{
+		template <typename Positive, typename X>
+		void operator()(Positive positive, X x, arrays a) const
+		{
+			mul(positive, x, a);
+		}
+	};
+
+	struct div_kernel{
+		template <typename Positive, typename X>
+		void operator()(Positive positive, X x, arrays a) const
+		{
+			div(positive, x, a);
+		}
+	};
+}
+
+int main()
+{
+	constexpr auto x = CTI_I(0.1, 0.3){};
+	static_assert(cti::certainly<std::greater<>>(x, zero{}), "x must be positive");
+
+	auto y = bench::random_intervals(n, -1e3, 1e3, 1);
+
+	run("mul", mul_kernel{}, x, y);
+	run("div", div_kernel{}, x, y);
+}
@@ -0,0 +1,92 @@
+// verified reductions: a plain floating-point dot product (not verified,
+// the speed of light), the naive kv::interval accumulation (rounding mode
+// switching) and cti::dot / cti::sum with K = 2 and K = 3, single-threaded
+// and on `threads` threads.  `width` is the width of each enclosure
+// relative to the magnitude of the result.
+//
+//     g++ -std=c++14 -O3 -march=native -ffp-contract=off -pthread -Iinclude bench/dot.cpp
+//     ./a.out [n = 10000000] [threads = 0 (all)]
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include <kv/interval.hpp>
+#include <kv/rdouble.hpp>
+
+#include <cti/rinterval.hpp>
+#include <cti/matrix.hpp>
+#include <cti/dot.hpp>
+
+#include "bench.hpp"
+
+namespace{
+	double relative_width(const cti::rinterval<double> &x)
+	{
+		double m = std::fabs(0.5 * x.lower() + 0.5 * x.upper());
+		return (x.upper() - x.lower()) / m;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+	unsigned threads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : 0;
+
+	auto xs = bench::random_intervals(n, -1.0, 1.0, 1);
+	auto ys = bench::random_intervals(n, -1.0, 1.0, 2);
+	const std::vector<double> &x = xs.first, &y = ys.first;
+
+	double plain = 0.0;
+	double t = bench::seconds([&]{
+		double s = 0.0;
+		for(std::size_t i = 0; i < n; ++i)
+			s += x[i] * y[i];
+		plain = s;
+		bench::do_not_optimize(plain);
+	});
+	bench::report("dot", "plain_double", n, t);
+
+	kv::interval<double> naive;
+	t = bench::seconds([&]{
+		kv::interval<double> s(0.0);
+		for(std::size_t i = 0; i < n; ++i)
+			s += kv::interval<double>(x[i]) * kv::interval<double>(y[i]);
+		naive = s;
+		bench::do_not_optimize(naive);
+	}, 1);
+	bench::report("dot", "kv_naive", n, t);
+	bench::report("dot", "kv_naive", "width", relative_width({naive.lower(), naive.upper()}));
+
+	cti::rinterval<double> r;
+
+	t = bench::seconds([&]{ r = cti::dot(x, y, 1); bench::do_not_optimize(r); });
+	bench::report("dot", "dot2", n, t);
+	bench::report("dot", "dot2", "width", relative_width(r));
+
+	t = bench::seconds([&]{ r = cti::dot(x, y, threads); bench::do_not_optimize(r); });
+	bench::report("dot", "dot2_threads", n, t);
+
+	t = bench::seconds([&]{ r = cti::dot<3>(x, y, 1); bench::do_not_optimize(r); });
+	bench::report("dot", "dot3", n, t);
+	bench::report("dot", "dot3", "width", relative_width(r));
+
+	t = bench::seconds([&]{ r = cti::sum(x, 1); bench::do_not_optimize(r); });
+	bench::report("sum", "sum2", n, t);
+	bench::report("sum", "sum2", "width", relative_width(r));
+
+	t = bench::seconds([&]{ r = cti::sum(x, threads); bench::do_not_optimize(r); });
+	bench::report("sum", "sum2_threads", n, t);
+
+	cti::ivector a, b;
+	a.inf = xs.first;
+	a.sup = xs.second;
+	b.inf = ys.first;
+	b.sup = ys.second;
+
+	t = bench::seconds([&]{ r = cti::dot(a, b, 1); bench::do_not_optimize(r); });
+	bench::report("dot", "interval_dot2", n, t);
+
+	t = bench::seconds([&]{ r = cti::dot(a, b, threads); bench::do_not_optimize(r); });
+	bench::report("dot", "interval_dot2_threads", n, t);
+}
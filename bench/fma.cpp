@@ -0,0 +1,85 @@
+// multiplication-heavy runtime code with the Dekker twoproduct of
+// trait<double> and the fma twoproduct of fma_trait.
+//
+//     g++ -std=c++14 -O2 -ffp-contract=off -Iinclude bench/fma.cpp          (runtime dispatch)
+//     g++ -std=c++14 -O2 -ffp-contract=off -mfma -Iinclude bench/fma.cpp    (fma at compile time)
+
+#include <cstring>
+#include <vector>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/fma.hpp>
+
+#include "bench.hpp"
+
+namespace{
+	constexpr std::size_t n = 1 << 20;
+
+	template <typename Trait>
+	void mul_up(const std::vector<double> &x, const std::vector<double> &y, std::vector<double> &z)
+	{
+		for(std::size_t i = 0; i < n; ++i)
+			z[i] = Trait::mul_up(x[i], y[i]);
+	}
+
+	template <typename Trait>
+	void div_down(const std::vector<double> &x, const std::vector<double> &y, std::vector<double> &z)
+	{
+		for(std::size_t i = 0; i < n; ++i)
+			z[i] = Trait::div_down(x[i], y[i]);
+	}
+
+	template <typename Trait>
+	void interval_mul(const std::vector<double> &inf1, const std::vector<double> &sup1,
+	                  const std::vector<double> &inf2, const std::vector<double> &sup2,
+	                  std::vector<double> &inf, std::vector<double> &sup)
+	{
+		for(std::size_t i = 0; i < n; ++i){
+			auto r = cti::detail::interval_operator_mul_impl1<double, Trait>(inf1[i], sup1[i], inf2[i], sup2[i]);
+			inf[i] = r.first;
+			sup[i] = r.second;
+		}
+	}
+
+	std::size_t mismatches(const std::vector<double> &x, const std::vector<double> &y)
+	{
+		std::size_t count = 0;
+		for(std::size_t i = 0; i < n; ++i)
+			count += std::memcmp(&x[i], &y[i], sizeof(double)) != 0;
+		return count;
+	}
+}
+
+int main()
+{
+	auto x = bench::random_intervals(n, -1e3, 1e3, 1);
+	auto y = bench::random_intervals(n, -1e3, 1e3, 2);
+
+	std::vector<double> z_dekker(n), z_fma(n), w_dekker(n), w_fma(n);
+
+	double t = bench::seconds([&]{ mul_up<cti::trait<double>>(x.first, y.first, z_dekker); bench::do_not_optimize(z_dekker); });
+	bench::report("mul_up", "dekker", n, t);
+	t = bench::seconds([&]{ mul_up<cti::runtime_trait>(x.first, y.first, z_fma); bench::do_not_optimize(z_fma); });
+	bench::report("mul_up", "fma", n, t);
+	bench::report("mul_up", "fma", "mismatches", static_cast<double>(mismatches(z_dekker, z_fma)));
+
+	t = bench::seconds([&]{ div_down<cti::trait<double>>(x.first, y.second, z_dekker); bench::do_not_optimize(z_dekker); });
+	bench::report("div_down", "dekker", n, t);
+	t = bench::seconds([&]{ div_down<cti::runtime_trait>(x.first, y.second, z_fma); bench::do_not_optimize(z_fma); });
+	bench::report("div_down", "fma", n, t);
+	bench::report("div_down", "fma", "mismatches", static_cast<double>(mismatches(z_dekker, z_fma)));
+
+	t = bench::seconds([&]{
+		interval_mul<cti::trait<double>>(x.first, x.second, y.first, y.second, z_dekker, w_dekker);
+		bench::do_not_optimize(z_dekker);
+	});
+	bench::report("interval_mul", "dekker", n, t);
+	t = bench::seconds([&]{
+		interval_mul<cti::runtime_trait>(x.first, x.second, y.first, y.second, z_fma, w_fma);
+		bench::do_not_optimize(z_fma);
+	});
+	bench::report("interval_mul", "fma", n, t);
+	bench::report("interval_mul", "fma", "mismatches",
+		static_cast<double>(mismatches(z_dekker, z_fma) + mismatches(w_dekker, w_fma)));
+}
@@ -0,0 +1,164 @@
+// the rounding-mode-switching backend (cti::hwround_*) against the
+// error-free-transformation backend (scalar trait<double> and the
+// vectorized cti::detail::batch_*).  hwround is called on blocks of
+// `block` intervals, each of which pays one fesetround pair; the variant
+// name carries the block size.  `mismatches` counts the bounds that differ
+// from trait<double>; 0 and -0 are equal, as are two NaNs.
+//
+//     g++ -std=c++14 -O2 -mavx2 -ffp-contract=off -Iinclude bench/hwround.cpp
+
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/batch.hpp>
+#include <cti/hwround.hpp>
+
+#include "bench.hpp"
+
+namespace{
+	constexpr std::size_t n = 1 << 20;
+
+	using kernel = void (*)(std::size_t, const double *, const double *, const double *, const double *, double *, double *);
+
+	void scalar_add(std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+	{
+		for(std::size_t i = 0; i < n; ++i){
+			inf[i] = cti::trait<double>::add_down(inf1[i], inf2[i]);
+			sup[i] = cti::trait<double>::add_up(sup1[i], sup2[i]);
+		}
+	}
+
+	void scalar_mul(std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+	{
+		for(std::size_t i = 0; i < n; ++i){
+			auto r = cti::detail::interval_operator_mul_impl1(inf1[i], sup1[i], inf2[i], sup2[i]);
+			inf[i] = r.first;
+			sup[i] = r.second;
+		}
+	}
+
+	void scalar_div(std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+	{
+		for(std::size_t i = 0; i < n; ++i){
+			auto r = cti::detail::interval_operator_div_impl1(inf1[i], sup1[i], inf2[i], sup2[i]);
+			inf[i] = r.first;
+			sup[i] = r.second;
+		}
+	}
+
+	void scalar_sqrt(std::size_t n, const double *inf1, const double *sup1, const double *, const double *, double *inf, double *sup)
+	{
+		for(std::size_t i = 0; i < n; ++i){
+			inf[i] = cti::trait<double>::sqrt_down(inf1[i]);
+			sup[i] = cti::trait<double>::sqrt_up(sup1[i]);
+		}
+	}
+
+	void batch_sqrt(std::size_t n, const double *inf1, const double *sup1, const double *, const double *, double *inf, double *sup)
+	{
+		cti::detail::batch_sqrt(n, inf1, sup1, inf, sup);
+	}
+
+	void hwround_sqrt(std::size_t n, const double *inf1, const double *sup1, const double *, const double *, double *inf, double *sup)
+	{
+		cti::hwround_sqrt(n, inf1, sup1, inf, sup);
+	}
+
+	// mixes ordinary values with zeros, infinities, subnormals and values
+	// close to the overflow threshold
+	void sprinkle(std::vector<double> &inf, std::vector<double> &sup, unsigned seed)
+	{
+		const double special[] = {
+			0.0, -0.0, 1e-310, -1e-310, 1e-300, 1e300, -1e300, 1.7e308, -1.7e308,
+			std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+		};
+
+		std::mt19937 engine(seed);
+
+		for(std::size_t i = 0; i < inf.size(); i += 7){
+			double a = special[engine() % (sizeof(special) / sizeof(*special))];
+			double b = engine() % 2 ? sup[i] : special[engine() % (sizeof(special) / sizeof(*special))];
+			inf[i] = a < b ? a : b;
+			sup[i] = a < b ? b : a;
+		}
+	}
+
+	bool same(double x, double y)
+	{
+		return x == y || (x != x && y != y);
+	}
+
+	std::size_t mismatches(const std::vector<double> &inf1, const std::vector<double> &sup1,
+	                       const std::vector<double> &inf2, const std::vector<double> &sup2)
+	{
+		std::size_t count = 0;
+		for(std::size_t i = 0; i < n; ++i){
+			if(!same(inf1[i], inf2[i]) || !same(sup1[i], sup2[i]))
+				++count;
+		}
+		return count;
+	}
+
+	void run(const char *name, kernel scalar, kernel batch, kernel hwround,
+	         const std::vector<double> &inf1, const std::vector<double> &sup1,
+	         const std::vector<double> &inf2, const std::vector<double> &sup2)
+	{
+		std::vector<double> inf_s(n), sup_s(n), inf_b(n), sup_b(n);
+
+		double t = bench::seconds([&]{
+			scalar(n, inf1.data(), sup1.data(), inf2.data(), sup2.data(), inf_s.data(), sup_s.data());
+			bench::do_not_optimize(inf_s);
+		});
+		bench::report(name, "eft_scalar", n, t);
+
+		t = bench::seconds([&]{
+			batch(n, inf1.data(), sup1.data(), inf2.data(), sup2.data(), inf_b.data(), sup_b.data());
+			bench::do_not_optimize(inf_b);
+		});
+		bench::report(name, "eft_batch", n, t);
+		bench::report(name, "eft_batch", "mismatches", static_cast<double>(mismatches(inf_s, sup_s, inf_b, sup_b)));
+
+		for(std::size_t block : {1, 10, 100, 1000, 10000}){
+			t = bench::seconds([&]{
+				for(std::size_t i = 0; i < n; i += block){
+					std::size_t m = n - i < block ? n - i : block;
+					hwround(m, inf1.data() + i, sup1.data() + i, inf2.data() + i, sup2.data() + i, inf_b.data() + i, sup_b.data() + i);
+				}
+				bench::do_not_optimize(inf_b);
+			});
+
+			std::string variant = "hwround_" + std::to_string(block);
+			bench::report(name, variant.c_str(), n, t);
+			bench::report(name, variant.c_str(), "mismatches", static_cast<double>(mismatches(inf_s, sup_s, inf_b, sup_b)));
+		}
+	}
+}
+
+int main()
+{
+	auto x = bench::random_intervals(n, -1e3, 1e3, 1);
+	auto y = bench::random_intervals(n, -1e3, 1e3, 2);
+	sprinkle(x.first, x.second, 3);
+	sprinkle(y.first, y.second, 4);
+
+	run("add", scalar_add, cti::detail::batch_add, cti::hwround_add, x.first, x.second, y.first, y.second);
+	run("mul", scalar_mul, cti::detail::batch_mul<>, cti::hwround_mul, x.first, x.second, y.first, y.second);
+
+	// divisors must not contain 0
+	auto d = bench::random_intervals(n, 1e-3, 1e3, 5);
+	for(std::size_t i = 0; i < n; i += 2){
+		double inf = d.first[i];
+		d.first[i] = -d.second[i];
+		d.second[i] = -inf;
+	}
+	run("div", scalar_div, cti::detail::batch_div, cti::hwround_div, x.first, x.second, d.first, d.second);
+
+	auto s = bench::random_intervals(n, 0.0, 1e3, 6);
+	for(std::size_t i = 0; i < n; i += 5)
+		s.first[i] = 1e-310;
+	run("sqrt", scalar_sqrt, batch_sqrt, hwround_sqrt, s.first, s.second, s.first, s.second);
+}
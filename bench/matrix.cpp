@@ -0,0 +1,96 @@
+// verified interval matrix product: a naive triple loop over kv::interval
+// (rounding mode switching), the blocked inf-sup kernel of cti::mul and the
+// midpoint-radius fast path cti::mul_midrad.  ops counts n^3 interval
+// multiply-adds.  `width_ratio` is the mean width of mul_midrad relative to
+// mul and `disjoint` counts entries where both enclosures do not overlap,
+// which must be 0.
+//
+//     g++ -std=c++14 -O3 -march=native -ffp-contract=off -pthread -Iinclude bench/matrix.cpp
+//     ./a.out [n = 1000] [threads = 0 (all)]
+
+#include <cstdlib>
+#include <vector>
+
+#include <kv/interval.hpp>
+#include <kv/rdouble.hpp>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/matrix.hpp>
+
+#include "bench.hpp"
+
+namespace{
+	cti::imatrix random_matrix(std::size_t n, unsigned seed)
+	{
+		auto x = bench::random_intervals(n * n, -1.0, 1.0, seed);
+
+		cti::imatrix a(n, n);
+		a.inf = std::move(x.first);
+		a.sup = std::move(x.second);
+
+		// narrow intervals around the midpoints, as in verified solvers
+		for(std::size_t i = 0; i < n * n; ++i){
+			double m = 0.5 * (a.inf[i] + a.sup[i]);
+			a.inf[i] = m - 1e-10;
+			a.sup[i] = m + 1e-10;
+		}
+
+		return a;
+	}
+
+	std::vector<kv::interval<double>> to_kv(const cti::imatrix &a)
+	{
+		std::vector<kv::interval<double>> b(a.inf.size());
+		for(std::size_t i = 0; i < b.size(); ++i)
+			b[i] = kv::interval<double>(a.inf[i], a.sup[i]);
+		return b;
+	}
+
+	void naive(const std::vector<kv::interval<double>> &a, const std::vector<kv::interval<double>> &b,
+	           std::vector<kv::interval<double>> &c, std::size_t n)
+	{
+		for(std::size_t i = 0; i < n; ++i){
+			for(std::size_t j = 0; j < n; ++j){
+				kv::interval<double> s(0.0);
+				for(std::size_t k = 0; k < n; ++k)
+					s += a[i * n + k] * b[k * n + j];
+				c[i * n + j] = s;
+			}
+		}
+	}
+}
+
+int main(int argc, char **argv)
+{
+	std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+	unsigned threads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : 0;
+	std::size_t ops = n * n * n;
+
+	auto a = random_matrix(n, 1);
+	auto b = random_matrix(n, 2);
+
+	auto a_kv = to_kv(a), b_kv = to_kv(b);
+	std::vector<kv::interval<double>> c_kv(n * n);
+
+	double t = bench::seconds([&]{ naive(a_kv, b_kv, c_kv, n); bench::do_not_optimize(c_kv); }, 1);
+	bench::report("imatrix_mul", "kv_naive", ops, t);
+
+	cti::imatrix c_infsup, c_midrad;
+
+	t = bench::seconds([&]{ c_infsup = cti::mul(a, b, threads); bench::do_not_optimize(c_infsup); }, 1);
+	bench::report("imatrix_mul", "infsup", ops, t);
+
+	t = bench::seconds([&]{ c_midrad = cti::mul_midrad(a, b, threads); bench::do_not_optimize(c_midrad); }, 3);
+	bench::report("imatrix_mul", "midrad", ops, t);
+
+	double ratio = 0.0;
+	std::size_t disjoint = 0;
+	for(std::size_t i = 0; i < n * n; ++i){
+		ratio += (c_midrad.sup[i] - c_midrad.inf[i]) / (c_infsup.sup[i] - c_infsup.inf[i]);
+		if(c_midrad.sup[i] < c_infsup.inf[i] || c_infsup.sup[i] < c_midrad.inf[i])
+			++disjoint;
+	}
+	bench::report("imatrix_mul", "midrad", "width_ratio", ratio / static_cast<double>(n * n));
+	bench::report("imatrix_mul", "midrad", "disjoint", static_cast<double>(disjoint));
+}
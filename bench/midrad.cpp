@@ -0,0 +1,144 @@
+// inf-sup (rinterval, imatrix) against midpoint-radius (mrinterval,
+// mrmatrix) arithmetic on vector and matrix workloads: an elementwise
+// a x + y, an interval dot product and the matrix product.  `width_ratio`
+// is the mean width of the midpoint-radius results relative to the inf-sup
+// ones.  the _fma variants use cti::runtime_trait.
+//
+//     g++ -std=c++14 -O3 -march=native -ffp-contract=off -pthread -Iinclude bench/midrad.cpp
+//     ./a.out [n = 300] [threads = 0 (all)]
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/fma.hpp>
+#include <cti/rinterval.hpp>
+#include <cti/mrinterval.hpp>
+#include <cti/matrix.hpp>
+
+#include "bench.hpp"
+
+namespace{
+	constexpr std::size_t length = 1 << 20;
+
+	template <typename I>
+	std::vector<I> random_vector(std::size_t n, unsigned seed)
+	{
+		auto x = bench::random_intervals(n, -1.0, 1.0, seed);
+
+		std::vector<I> v(n);
+		for(std::size_t i = 0; i < n; ++i){
+			double m = 0.5 * (x.first[i] + x.second[i]);
+			v[i] = I(cti::rinterval<double>(m - 1e-10, m + 1e-10));
+		}
+		return v;
+	}
+
+	template <typename I>
+	void axpy(const std::vector<I> &a, const std::vector<I> &x, const std::vector<I> &y, std::vector<I> &z)
+	{
+		for(std::size_t i = 0; i < length; ++i)
+			z[i] = a[i] * x[i] + y[i];
+	}
+
+	template <typename I>
+	I dot(const std::vector<I> &x, const std::vector<I> &y)
+	{
+		I s(0.0);
+		for(std::size_t i = 0; i < length; ++i)
+			s += x[i] * y[i];
+		return s;
+	}
+
+	template <typename I>
+	double width(const I &x)
+	{
+		return x.upper() - x.lower();
+	}
+
+	template <typename RI, typename MRI>
+	void vector_workloads(const std::string &suffix)
+	{
+		auto a = random_vector<RI>(length, 1), x = random_vector<RI>(length, 2), y = random_vector<RI>(length, 3);
+		auto a_mr = random_vector<MRI>(length, 1), x_mr = random_vector<MRI>(length, 2), y_mr = random_vector<MRI>(length, 3);
+		std::vector<RI> z(length);
+		std::vector<MRI> z_mr(length);
+
+		double t = bench::seconds([&]{ axpy(a, x, y, z); bench::do_not_optimize(z); });
+		bench::report("axpy", ("infsup" + suffix).c_str(), length, t);
+
+		t = bench::seconds([&]{ axpy(a_mr, x_mr, y_mr, z_mr); bench::do_not_optimize(z_mr); });
+		bench::report("axpy", ("midrad" + suffix).c_str(), length, t);
+
+		double ratio = 0.0;
+		for(std::size_t i = 0; i < length; ++i)
+			ratio += width(z_mr[i]) / width(z[i]);
+		bench::report("axpy", ("midrad" + suffix).c_str(), "width_ratio", ratio / static_cast<double>(length));
+
+		RI d;
+		MRI d_mr;
+
+		t = bench::seconds([&]{ d = dot(x, y); bench::do_not_optimize(d); });
+		bench::report("dot", ("infsup" + suffix).c_str(), length, t);
+
+		t = bench::seconds([&]{ d_mr = dot(x_mr, y_mr); bench::do_not_optimize(d_mr); });
+		bench::report("dot", ("midrad" + suffix).c_str(), length, t);
+		bench::report("dot", ("midrad" + suffix).c_str(), "width_ratio", width(d_mr) / width(d));
+	}
+}
+
+int main(int argc, char **argv)
+{
+	std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 300;
+	unsigned threads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : 0;
+
+	using ri = cti::rinterval<double>;
+	using mri = cti::mrinterval<double>;
+
+	auto va = random_vector<ri>(n * n, 4), vb = random_vector<ri>(n * n, 5);
+
+	vector_workloads<ri, mri>("");
+	vector_workloads<cti::rinterval<double, cti::runtime_trait>, cti::mrinterval<double, cti::runtime_trait>>("_fma");
+
+	cti::imatrix ma(n, n), mb(n, n);
+	for(std::size_t i = 0; i < n * n; ++i){
+		ma.set(i / n, i % n, va[i]);
+		mb.set(i / n, i % n, vb[i]);
+	}
+	auto ma_mr = cti::to_midrad(ma), mb_mr = cti::to_midrad(mb);
+
+	std::size_t ops = n * n * n;
+	cti::imatrix c;
+	cti::mrmatrix c_mr;
+
+	double t = bench::seconds([&]{ c = cti::mul(ma, mb, threads); bench::do_not_optimize(c); }, 1);
+	bench::report("matrix_mul", "infsup", ops, t);
+
+	t = bench::seconds([&]{ c_mr = cti::mul(ma_mr, mb_mr, threads); bench::do_not_optimize(c_mr); }, 3);
+	bench::report("matrix_mul", "midrad", ops, t);
+
+	double ratio = 0.0;
+	for(std::size_t i = 0; i < n; ++i){
+		for(std::size_t j = 0; j < n; ++j)
+			ratio += width(c_mr(i, j)) / width(c(i, j));
+	}
+	bench::report("matrix_mul", "midrad", "width_ratio", ratio / static_cast<double>(n * n));
+
+	cti::ivector v(n);
+	cti::mrmatrix v_mr(n, 1);
+	for(std::size_t i = 0; i < n; ++i){
+		v.set(i, va[i]);
+		v_mr.set(i, 0, mri(va[i]));
+	}
+
+	cti::ivector w;
+	cti::mrmatrix w_mr;
+
+	t = bench::seconds([&]{ w = cti::mul(ma, v, 1); bench::do_not_optimize(w); });
+	bench::report("matrix_vector", "infsup", n * n, t);
+
+	t = bench::seconds([&]{ w_mr = cti::mul(ma_mr, v_mr, 1); bench::do_not_optimize(w_mr); });
+	bench::report("matrix_vector", "midrad", n * n, t);
+}
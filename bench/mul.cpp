@@ -0,0 +1,115 @@
+// interval multiplication on inputs of random sign: the nine-case sign
+// dispatch (mul_by_cases) against the branch-free min/max of the four
+// products (mul_by_minmax), scalar and batched.  the edge-case check runs
+// both policies on every pair of intervals built from a set of special
+// endpoints and counts results that differ in value.
+//
+//     g++ -std=c++14 -O2 -mavx2 -mfma -ffp-contract=off -Iinclude bench/mul.cpp
+
+#include <limits>
+#include <vector>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/fma.hpp>
+#include <cti/batch.hpp>
+
+#include "bench.hpp"
+
+namespace{
+	constexpr std::size_t n = 1 << 20;
+
+	template <typename Policy, typename Trait>
+	void scalar(const std::vector<double> &inf1, const std::vector<double> &sup1,
+	            const std::vector<double> &inf2, const std::vector<double> &sup2,
+	            std::vector<double> &inf, std::vector<double> &sup)
+	{
+		for(std::size_t i = 0; i < n; ++i){
+			auto r = Policy::template apply<double, Trait>(inf1[i], sup1[i], inf2[i], sup2[i]);
+			inf[i] = r.first;
+			sup[i] = r.second;
+		}
+	}
+
+	bool same(double x, double y)
+	{
+		return x == y || (x != x && y != y);
+	}
+
+	std::size_t edge_cases()
+	{
+		constexpr double inf = std::numeric_limits<double>::infinity();
+		constexpr double max = std::numeric_limits<double>::max();
+		constexpr double min = std::numeric_limits<double>::denorm_min();
+
+		const double values[] = {
+			-inf, -max, -1e300, -2.0, -1.0, -1e-300, -min, -0.0,
+			0.0, min, 1e-300, 1.0, 2.0, 1e300, max, inf,
+		};
+
+		std::size_t mismatch = 0;
+
+		for(double a : values) for(double b : values){
+			if(b < a || a == inf || b == -inf)
+				continue;
+			for(double c : values) for(double d : values){
+				if(d < c || c == inf || d == -inf)
+					continue;
+
+				auto x = cti::mul_by_cases::apply<double>(a, b, c, d);
+				auto y = cti::mul_by_minmax::apply<double>(a, b, c, d);
+
+				if(!same(x.first, y.first) || !same(x.second, y.second))
+					++mismatch;
+			}
+		}
+
+		return mismatch;
+	}
+}
+
+int main()
+{
+	auto x = bench::random_intervals(n, -1.0, 1.0, 1);
+	auto y = bench::random_intervals(n, -1.0, 1.0, 2);
+
+	std::vector<double> inf(n), sup(n);
+
+	double t = bench::seconds([&]{
+		scalar<cti::mul_by_cases, cti::trait<double>>(x.first, x.second, y.first, y.second, inf, sup);
+		bench::do_not_optimize(inf);
+	});
+	bench::report("interval_mul", "cases", n, t);
+
+	t = bench::seconds([&]{
+		scalar<cti::mul_by_minmax, cti::trait<double>>(x.first, x.second, y.first, y.second, inf, sup);
+		bench::do_not_optimize(inf);
+	});
+	bench::report("interval_mul", "minmax", n, t);
+
+	t = bench::seconds([&]{
+		scalar<cti::mul_by_cases, cti::runtime_trait>(x.first, x.second, y.first, y.second, inf, sup);
+		bench::do_not_optimize(inf);
+	});
+	bench::report("interval_mul", "cases+runtime_trait", n, t);
+
+	t = bench::seconds([&]{
+		scalar<cti::mul_by_minmax, cti::runtime_trait>(x.first, x.second, y.first, y.second, inf, sup);
+		bench::do_not_optimize(inf);
+	});
+	bench::report("interval_mul", "minmax+runtime_trait", n, t);
+
+	t = bench::seconds([&]{
+		cti::detail::batch_mul<cti::mul_by_cases>(n, x.first.data(), x.second.data(), y.first.data(), y.second.data(), inf.data(), sup.data());
+		bench::do_not_optimize(inf);
+	});
+	bench::report("interval_mul", "batch+cases", n, t);
+
+	t = bench::seconds([&]{
+		cti::detail::batch_mul<cti::mul_by_minmax>(n, x.first.data(), x.second.data(), y.first.data(), y.second.data(), inf.data(), sup.data());
+		bench::do_not_optimize(inf);
+	});
+	bench::report("interval_mul", "batch+minmax", n, t);
+
+	bench::report("interval_mul", "minmax", "edge_case_mismatches", static_cast<double>(edge_cases()));
+}
@@ -0,0 +1,72 @@
+// cti::parallel_map over a grid of intervals with 1, 2, 4, ... threads up
+// to the number of hardware threads (or the given maximum).  every run
+// reports the total throughput and the throughput of each thread.
+//
+//     g++ -std=c++14 -O3 -march=native -ffp-contract=off -pthread -Iinclude bench/parallel.cpp
+//     ./a.out [n = 10000000] [max threads = 0 (all)]
+
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/fma.hpp>
+#include <cti/rinterval.hpp>
+#include <cti/parallel.hpp>
+
+#include "bench.hpp"
+
+namespace{
+	using interval = cti::rinterval<double, cti::runtime_trait>;
+
+	// the grid [i / n, (i + 1) / n] of [0, 1]
+	std::vector<interval> grid(std::size_t n)
+	{
+		std::vector<interval> x(n);
+		for(std::size_t i = 0; i < n; ++i)
+			x[i] = interval(static_cast<double>(i) / n, static_cast<double>(i + 1) / n);
+		return x;
+	}
+
+	struct f{
+		interval operator()(const interval &x) const
+		{
+			return x * (1.0 - x) * (x + 2.0) / (x * x + 1.0);
+		}
+	};
+}
+
+int main(int argc, char **argv)
+{
+	std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+	unsigned max_threads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : 0;
+	if(max_threads == 0)
+		max_threads = cti::detail::default_threads();
+
+	auto x = grid(n);
+	std::vector<interval> y(n);
+
+	for(unsigned threads = 1; ; threads *= 2){
+		if(threads > max_threads)
+			threads = max_threads;
+
+		cti::parallel_map_stats stats;
+		double t = bench::seconds([&]{
+			stats = cti::parallel_map(x.data(), n, y.data(), f{}, threads);
+			bench::do_not_optimize(y);
+		}, 3);
+
+		std::string variant = std::to_string(threads) + "_threads";
+		bench::report("parallel_map", variant.c_str(), n, t);
+
+		for(unsigned i = 0; i < stats.threads(); ++i){
+			std::string name = variant + "/thread_" + std::to_string(i);
+			bench::report("parallel_map", name.c_str(), "ops_per_second", stats.throughput(i));
+		}
+
+		if(threads == max_threads)
+			break;
+	}
+}
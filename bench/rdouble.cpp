@@ -0,0 +1,240 @@
+// latency and throughput of every trait<double> primitive at run time,
+// against kv::rop<double> and against switching the hardware rounding
+// mode around each operation with fesetround.  the inputs are normal,
+// subnormal, huge (|x| >= 2^1000, so products and quotients overflow) or
+// infinite (x = +-inf, y normal).
+//
+// `throughput` applies the primitive to independent inputs.  `latency`
+// makes each input index depend on the previous result, so it includes
+// the cost of that dependency, which is reported as the `identity`
+// primitive.  `mismatches` counts the results of cti that differ from
+// the fesetround ones.
+//
+//     g++ -std=c++14 -O2 -ffp-contract=off -frounding-math -Iinclude bench/rdouble.cpp
+//     ./a.out > rdouble.jsonl
+
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <kv/rdouble.hpp>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+
+#include "bench.hpp"
+
+namespace{
+	using cti_trait = cti::trait<double>;
+	using kv_rop = kv::rop<double>;
+
+	constexpr std::size_t n = 1 << 12;
+	constexpr std::size_t rounds = 64;
+
+	struct inputs{
+		const char *name;
+		std::vector<double> x;
+		std::vector<double> y;
+	};
+
+	// n pairs with |x|, |y| in [2^lower, 2^upper) and random signs
+	inputs random_inputs(const char *name, int lower, int upper, unsigned seed)
+	{
+		std::mt19937_64 engine(seed);
+		std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+		std::uniform_int_distribution<int> exponent(lower, upper - 1);
+		std::bernoulli_distribution sign;
+
+		auto draw = [&]{
+			double a = std::ldexp(mantissa(engine), exponent(engine));
+			return sign(engine) ? -a : a;
+		};
+
+		inputs in{name, std::vector<double>(n), std::vector<double>(n)};
+		for(std::size_t i = 0; i < n; ++i){
+			in.x[i] = draw();
+			in.y[i] = draw();
+		}
+		return in;
+	}
+
+	std::vector<inputs> input_classes()
+	{
+		std::vector<inputs> classes;
+		classes.push_back(random_inputs("normal", -20, 20, 1));
+		classes.push_back(random_inputs("subnormal", -1070, -1023, 2));
+		classes.push_back(random_inputs("huge", 1000, 1024, 3));
+
+		auto infinite = random_inputs("infinite", -20, 20, 4);
+		for(std::size_t i = 0; i < n; ++i)
+			infinite.x[i] = std::copysign(std::numeric_limits<double>::infinity(), infinite.x[i]);
+		classes.push_back(std::move(infinite));
+
+		return classes;
+	}
+
+	// keeps the compiler from moving x across a rounding mode switch
+	inline void pin(double &x)
+	{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+		asm volatile("" : "+x"(x));
+#else
+		volatile double v = x;
+		x = v;
+#endif
+	}
+
+	template <int Mode, typename F>
+	inline double rounded(double x, double y, F f)
+	{
+		std::fesetround(Mode);
+		pin(x);
+		pin(y);
+		double r = f(x, y);
+		pin(r);
+		std::fesetround(FE_TONEAREST);
+		return r;
+	}
+
+	template <typename F>
+	void throughput(const inputs &in, std::vector<double> &z, F f)
+	{
+		for(std::size_t k = 0; k < rounds; ++k){
+			for(std::size_t i = 0; i < n; ++i)
+				z[i] = f(in.x[i], in.y[i]);
+			bench::do_not_optimize(z);
+		}
+	}
+
+	// `zero` is 0, but opaque to the compiler
+	template <typename F>
+	double latency(const inputs &in, std::uint64_t zero, F f)
+	{
+		double r = 0.0;
+		for(std::size_t k = 0; k < rounds; ++k){
+			for(std::size_t i = 0; i < n; ++i){
+				std::uint64_t bits;
+				std::memcpy(&bits, &r, sizeof(double));
+				std::size_t j = (i + (bits & zero)) & (n - 1);
+				r = f(in.x[j], in.y[j]);
+			}
+		}
+		return r;
+	}
+
+	std::size_t mismatches(const std::vector<double> &x, const std::vector<double> &y)
+	{
+		std::size_t count = 0;
+		for(std::size_t i = 0; i < n; ++i)
+			count += std::memcmp(&x[i], &y[i], sizeof(double)) != 0;
+		return count;
+	}
+
+	volatile std::uint64_t opaque_zero = 0;
+
+	template <typename F>
+	void measure(const std::vector<inputs> &classes, const char *primitive, const char *backend, F f,
+	             std::vector<std::vector<double>> *results = nullptr)
+	{
+		std::uint64_t zero = opaque_zero;
+
+		for(std::size_t c = 0; c < classes.size(); ++c){
+			const inputs &in = classes[c];
+			std::string name = std::string(primitive) + "/" + in.name;
+			std::vector<double> z(n);
+
+			double t = bench::seconds([&]{ throughput(in, z, f); });
+			bench::report(name.c_str(), (std::string(backend) + "/throughput").c_str(), n * rounds, t);
+
+			t = bench::seconds([&]{ double r = latency(in, zero, f); bench::do_not_optimize(r); });
+			bench::report(name.c_str(), (std::string(backend) + "/latency").c_str(), n * rounds, t);
+
+			if(results)
+				(*results)[c] = std::move(z);
+		}
+	}
+
+	// cti against kv and fesetround, with the mismatch count of cti
+	template <typename F, typename G, typename H>
+	void compare(const std::vector<inputs> &classes, const char *primitive, F cti_f, G kv_f, H hw_f)
+	{
+		std::vector<std::vector<double>> z(classes.size()), w(classes.size());
+
+		measure(classes, primitive, "cti", cti_f, &z);
+		measure(classes, primitive, "kv", kv_f);
+		measure(classes, primitive, "fesetround", hw_f, &w);
+
+		for(std::size_t c = 0; c < classes.size(); ++c){
+			std::string name = std::string(primitive) + "/" + classes[c].name;
+			bench::report(name.c_str(), "cti", "mismatches", static_cast<double>(mismatches(z[c], w[c])));
+		}
+	}
+}
+
+int main()
+{
+	auto classes = input_classes();
+
+	// sqrt takes |x|
+	auto sqrt_classes = classes;
+	for(auto &in : sqrt_classes){
+		for(auto &x : in.x)
+			x = std::fabs(x);
+	}
+
+	measure(classes, "identity", "none", [](double x, double){ return x; });
+
+	measure(classes, "twosum", "cti", [](double x, double y){ return cti_trait::twosum(x, y).second; });
+	measure(classes, "twoproduct", "cti", [](double x, double y){ return cti_trait::twoproduct(x, y).second; });
+
+	measure(classes, "succ", "cti", [](double x, double){ return cti_trait::succ(x); });
+	measure(classes, "succ", "nextafter", [](double x, double){ return std::nextafter(x, std::numeric_limits<double>::infinity()); });
+	measure(classes, "pred", "cti", [](double x, double){ return cti_trait::pred(x); });
+	measure(classes, "pred", "nextafter", [](double x, double){ return std::nextafter(x, -std::numeric_limits<double>::infinity()); });
+
+	compare(classes, "add_up",
+		[](double x, double y){ return cti_trait::add_up(x, y); },
+		[](double x, double y){ return kv_rop::add_up(x, y); },
+		[](double x, double y){ return rounded<FE_UPWARD>(x, y, [](double a, double b){ return a + b; }); });
+	compare(classes, "add_down",
+		[](double x, double y){ return cti_trait::add_down(x, y); },
+		[](double x, double y){ return kv_rop::add_down(x, y); },
+		[](double x, double y){ return rounded<FE_DOWNWARD>(x, y, [](double a, double b){ return a + b; }); });
+	compare(classes, "sub_up",
+		[](double x, double y){ return cti_trait::sub_up(x, y); },
+		[](double x, double y){ return kv_rop::sub_up(x, y); },
+		[](double x, double y){ return rounded<FE_UPWARD>(x, y, [](double a, double b){ return a - b; }); });
+	compare(classes, "sub_down",
+		[](double x, double y){ return cti_trait::sub_down(x, y); },
+		[](double x, double y){ return kv_rop::sub_down(x, y); },
+		[](double x, double y){ return rounded<FE_DOWNWARD>(x, y, [](double a, double b){ return a - b; }); });
+	compare(classes, "mul_up",
+		[](double x, double y){ return cti_trait::mul_up(x, y); },
+		[](double x, double y){ return kv_rop::mul_up(x, y); },
+		[](double x, double y){ return rounded<FE_UPWARD>(x, y, [](double a, double b){ return a * b; }); });
+	compare(classes, "mul_down",
+		[](double x, double y){ return cti_trait::mul_down(x, y); },
+		[](double x, double y){ return kv_rop::mul_down(x, y); },
+		[](double x, double y){ return rounded<FE_DOWNWARD>(x, y, [](double a, double b){ return a * b; }); });
+	compare(classes, "div_up",
+		[](double x, double y){ return cti_trait::div_up(x, y); },
+		[](double x, double y){ return kv_rop::div_up(x, y); },
+		[](double x, double y){ return rounded<FE_UPWARD>(x, y, [](double a, double b){ return a / b; }); });
+	compare(classes, "div_down",
+		[](double x, double y){ return cti_trait::div_down(x, y); },
+		[](double x, double y){ return kv_rop::div_down(x, y); },
+		[](double x, double y){ return rounded<FE_DOWNWARD>(x, y, [](double a, double b){ return a / b; }); });
+	compare(sqrt_classes, "sqrt_up",
+		[](double x, double){ return cti_trait::sqrt_up(x); },
+		[](double x, double){ return kv_rop::sqrt_up(x); },
+		[](double x, double y){ return rounded<FE_UPWARD>(x, y, [](double a, double){ return std::sqrt(a); }); });
+	compare(sqrt_classes, "sqrt_down",
+		[](double x, double){ return cti_trait::sqrt_down(x); },
+		[](double x, double){ return kv_rop::sqrt_down(x); },
+		[](double x, double y){ return rounded<FE_DOWNWARD>(x, y, [](double a, double){ return std::sqrt(a); }); });
+}
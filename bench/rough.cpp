@@ -0,0 +1,139 @@
+// rounding with the error-free transformations of trait<double> against
+// the one-ulp outward bump of rough_trait: throughput of the primitives
+// and of interval operations, and the width penalty of rough_trait as the
+// mean ratio of the widths (rough / exact).  `not_enclosing` counts rough
+// results that fail to contain the exact ones and must be 0.
+//
+//     g++ -std=c++14 -O2 -ffp-contract=off -Iinclude bench/rough.cpp
+
+#include <cstddef>
+#include <vector>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/rinterval.hpp>
+#include <cti/rough.hpp>
+
+#include "bench.hpp"
+
+namespace{
+	constexpr std::size_t n = 1 << 20;
+	constexpr int degree = 32;
+
+	template <typename Trait>
+	void add_up(const std::vector<double> &x, const std::vector<double> &y, std::vector<double> &z)
+	{
+		for(std::size_t i = 0; i < n; ++i)
+			z[i] = Trait::add_up(x[i], y[i]);
+	}
+
+	template <typename Trait>
+	void mul_up(const std::vector<double> &x, const std::vector<double> &y, std::vector<double> &z)
+	{
+		for(std::size_t i = 0; i < n; ++i)
+			z[i] = Trait::mul_up(x[i], y[i]);
+	}
+
+	template <typename Trait>
+	void div_up(const std::vector<double> &x, const std::vector<double> &y, std::vector<double> &z)
+	{
+		for(std::size_t i = 0; i < n; ++i)
+			z[i] = Trait::div_up(x[i], y[i]);
+	}
+
+	template <typename Trait>
+	void interval_mul(const std::vector<double> &inf1, const std::vector<double> &sup1,
+	                  const std::vector<double> &inf2, const std::vector<double> &sup2,
+	                  std::vector<double> &inf, std::vector<double> &sup)
+	{
+		for(std::size_t i = 0; i < n; ++i){
+			auto r = cti::detail::interval_operator_mul_impl1<double, Trait>(inf1[i], sup1[i], inf2[i], sup2[i]);
+			inf[i] = r.first;
+			sup[i] = r.second;
+		}
+	}
+
+	// sum_k x^k / (k + 1) in horner form at every x
+	template <typename Trait>
+	void horner(const std::vector<double> &x, std::vector<double> &inf, std::vector<double> &sup)
+	{
+		using interval = cti::rinterval<double, Trait>;
+
+		for(std::size_t i = 0; i < n; ++i){
+			interval p(1.0 / (degree + 1));
+			for(int k = degree - 1; k >= 0; --k)
+				p = p * x[i] + interval(1.0) / static_cast<double>(k + 1);
+			inf[i] = p.lower();
+			sup[i] = p.upper();
+		}
+	}
+
+	void report_width(const char *benchmark,
+	                  const std::vector<double> &inf_exact, const std::vector<double> &sup_exact,
+	                  const std::vector<double> &inf_rough, const std::vector<double> &sup_rough)
+	{
+		double ratio = 0.0;
+		std::size_t count = 0, not_enclosing = 0;
+
+		for(std::size_t i = 0; i < inf_exact.size(); ++i){
+			if(inf_rough[i] > inf_exact[i] || sup_rough[i] < sup_exact[i])
+				++not_enclosing;
+
+			double w = sup_exact[i] - inf_exact[i];
+			if(w > 0.0){
+				ratio += (sup_rough[i] - inf_rough[i]) / w;
+				++count;
+			}
+		}
+
+		bench::report(benchmark, "rough", "width_ratio", ratio / count);
+		bench::report(benchmark, "rough", "not_enclosing", static_cast<double>(not_enclosing));
+	}
+}
+
+int main()
+{
+	auto x = bench::random_intervals(n, -1e3, 1e3, 1);
+	auto y = bench::random_intervals(n, 1e-3, 1e3, 2);
+	auto u = bench::random_intervals(n, -0.9, 0.9, 3);
+
+	std::vector<double> z(n), inf_exact(n), sup_exact(n), inf_rough(n), sup_rough(n);
+
+	double t = bench::seconds([&]{ add_up<cti::trait<double>>(x.first, y.first, z); bench::do_not_optimize(z); });
+	bench::report("add_up", "exact", n, t);
+	t = bench::seconds([&]{ add_up<cti::rough_trait>(x.first, y.first, z); bench::do_not_optimize(z); });
+	bench::report("add_up", "rough", n, t);
+
+	t = bench::seconds([&]{ mul_up<cti::trait<double>>(x.first, y.first, z); bench::do_not_optimize(z); });
+	bench::report("mul_up", "exact", n, t);
+	t = bench::seconds([&]{ mul_up<cti::rough_trait>(x.first, y.first, z); bench::do_not_optimize(z); });
+	bench::report("mul_up", "rough", n, t);
+
+	t = bench::seconds([&]{ div_up<cti::trait<double>>(x.first, y.first, z); bench::do_not_optimize(z); });
+	bench::report("div_up", "exact", n, t);
+	t = bench::seconds([&]{ div_up<cti::rough_trait>(x.first, y.first, z); bench::do_not_optimize(z); });
+	bench::report("div_up", "rough", n, t);
+
+	t = bench::seconds([&]{
+		interval_mul<cti::trait<double>>(x.first, x.second, y.first, y.second, inf_exact, sup_exact);
+		bench::do_not_optimize(inf_exact);
+	});
+	bench::report("interval_mul", "exact", n, t);
+	t = bench::seconds([&]{
+		interval_mul<cti::rough_trait>(x.first, x.second, y.first, y.second, inf_rough, sup_rough);
+		bench::do_not_optimize(inf_rough);
+	});
+	bench::report("interval_mul", "rough", n, t);
+	report_width("interval_mul", inf_exact, sup_exact, inf_rough, sup_rough);
+
+	// point operands show the penalty of a single operation
+	interval_mul<cti::trait<double>>(x.first, x.first, y.first, y.first, inf_exact, sup_exact);
+	interval_mul<cti::rough_trait>(x.first, x.first, y.first, y.first, inf_rough, sup_rough);
+	report_width("interval_mul_point", inf_exact, sup_exact, inf_rough, sup_rough);
+
+	t = bench::seconds([&]{ horner<cti::trait<double>>(u.first, inf_exact, sup_exact); bench::do_not_optimize(inf_exact); });
+	bench::report("horner", "exact", n * degree * 3, t);
+	t = bench::seconds([&]{ horner<cti::rough_trait>(u.first, inf_rough, sup_rough); bench::do_not_optimize(inf_rough); });
+	bench::report("horner", "rough", n * degree * 3, t);
+	report_width("horner", inf_exact, sup_exact, inf_rough, sup_rough);
+}
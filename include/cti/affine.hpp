@@ -0,0 +1,347 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <tuple>
+#include <type_traits>
+
+#include <kv/interval.hpp>
+
+#include <sprout/math/fabs.hpp>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/rinterval.hpp>
+
+namespace cti{
+	// affine form x0 + x1 e1 + ... + xN eN + err e, where every noise symbol
+	// ei and e ranges over [-1, 1]
+	//
+	// the symbols e1 .. eN are shared between forms, so correlations between
+	// the operands cancel: x - x is exactly 0 and x (1 - x) over [0, 1] is
+	// enclosed in [0, 0.5] instead of [0, 1].  the number of symbols is
+	// fixed, which keeps the type literal; the nonlinear terms and the
+	// rounding errors of the coefficients (rounded to nearest, bounded with
+	// Trait's directed operations) are collected in err, which is not shared.
+	// the coefficients must be finite.
+	//
+	//     constexpr cti::affine<double, 2> x(CTI_I(0.0, 1.0){}, 0);
+	//     constexpr auto y = x * (1.0 - x);
+	//     using Y = CTI_TO_INTERVAL(y);  // cti::interval
+	//     cti::rinterval<double> z = y.to_rinterval();
+	template <typename T, ::std::size_t N, typename Trait = trait<T>>
+	class affine{
+		static_assert(N > 0, "cti::affine needs at least one noise symbol");
+
+		T x0 = 0.0;
+		T x[N] = {};
+		T err = 0.0;
+
+		// fl(a + b) and fl(a b), adding a bound of the rounding error to e
+		static constexpr T add(const T &a, const T &b, T &e)
+		{
+			auto s = Trait::twosum(a, b);
+			e = Trait::add_up(e, ::sprout::fabs(::std::get<1>(s)));
+			return ::std::get<0>(s);
+		}
+
+		static constexpr T mul(const T &a, const T &b, T &e)
+		{
+			T p = a * b;
+			e = Trait::add_up(e, detail::interval_operator_max(Trait::sub_up(Trait::mul_up(a, b), p), Trait::sub_up(p, Trait::mul_down(a, b))));
+			return p;
+		}
+
+		// [ c - d, c + d ] covering [lo, hi]
+		static constexpr ::std::pair<T, T> midrad(const T &lo, const T &hi)
+		{
+			T c = lo * 0.5 + hi * 0.5;
+			return {c, detail::interval_operator_max(Trait::sub_up(c, lo), Trait::sub_up(hi, c))};
+		}
+
+		// alpha x + zeta +- delta
+		static constexpr affine linear(const affine &x, const T &alpha, const ::std::pair<T, T> &zeta)
+		{
+			affine z = x * alpha;
+			z.x0 = add(z.x0, ::std::get<0>(zeta), z.err);
+			z.err = Trait::add_up(z.err, ::std::get<1>(zeta));
+			return z;
+		}
+
+		// min-range approximation of 1 / x for x > 0: with alpha = -1 / b^2,
+		// 1 / x - alpha x is convex, at most its value at a or b, and at
+		// least 2 sqrt(-alpha)
+		static constexpr affine reciprocal_positive(const affine &x, const T &a, const T &b)
+		{
+			T alpha = -(1.0 / b) / b;
+			T lo = Trait::mul_down(2.0, Trait::sqrt_down(-alpha));
+			T hi = detail::interval_operator_max(
+				Trait::add_up(Trait::div_up(1.0, a), Trait::mul_up(-alpha, a)),
+				Trait::add_up(Trait::div_up(1.0, b), Trait::mul_up(-alpha, b)));
+			return linear(x, alpha, midrad(lo, hi));
+		}
+
+	public:
+		using value_type = T;
+		using trait_type = Trait;
+
+		constexpr affine()
+		{
+		}
+
+		constexpr affine(const T &c)
+			: x0(c)
+		{
+		}
+
+		// a new variable [inf, sup] = mid + rad e_k
+		constexpr affine(const T &inf, const T &sup, ::std::size_t k)
+		{
+			if(k >= N)
+				throw ::std::out_of_range("cti::affine: noise symbol out of range");
+			if(inf == -::std::numeric_limits<T>::infinity() || sup == ::std::numeric_limits<T>::infinity())
+				throw ::std::domain_error("cti::affine: unbounded interval");
+
+			auto m = midrad(inf, sup);
+			x0 = ::std::get<0>(m);
+			x[k] = ::std::get<1>(m);
+		}
+
+		template <typename Inf, typename Sup>
+		constexpr affine(interval<Inf, Sup>, ::std::size_t k)
+			: affine(Inf::value, Sup::value, k)
+		{
+		}
+
+		template <typename Trait2>
+		constexpr affine(const rinterval<T, Trait2> &x, ::std::size_t k)
+			: affine(x.lower(), x.upper(), k)
+		{
+		}
+
+		static constexpr ::std::size_t size()
+		{
+			return N;
+		}
+
+		constexpr T center() const
+		{
+			return x0;
+		}
+
+		constexpr T coefficient(::std::size_t i) const
+		{
+			return x[i];
+		}
+
+		constexpr T error() const
+		{
+			return err;
+		}
+
+		// |x1| + ... + |xN| + err, rounded upward
+		constexpr T rad() const
+		{
+			T r = err;
+			for(::std::size_t i = 0; i < N; ++i)
+				r = Trait::add_up(r, ::sprout::fabs(x[i]));
+			return r;
+		}
+
+		constexpr T lower() const
+		{
+			return Trait::sub_down(x0, rad());
+		}
+
+		constexpr T upper() const
+		{
+			return Trait::add_up(x0, rad());
+		}
+
+		constexpr rinterval<T, Trait> to_rinterval() const
+		{
+			T r = rad();
+			return {Trait::sub_down(x0, r), Trait::add_up(x0, r)};
+		}
+
+		explicit operator ::kv::interval<T>() const
+		{
+			return {lower(), upper()};
+		}
+
+		::kv::interval<T> to_kv() const
+		{
+			return static_cast<::kv::interval<T>>(*this);
+		}
+
+		friend ::std::ostream &operator<<(::std::ostream &os, const affine &x)
+		{
+			return os << x.to_rinterval();
+		}
+
+		friend constexpr affine operator+(const affine &x, const affine &y)
+		{
+			affine z;
+			z.x0 = add(x.x0, y.x0, z.err);
+			for(::std::size_t i = 0; i < N; ++i)
+				z.x[i] = add(x.x[i], y.x[i], z.err);
+			z.err = Trait::add_up(z.err, Trait::add_up(x.err, y.err));
+			return z;
+		}
+
+		friend constexpr affine operator+(const affine &x, const T &y)
+		{
+			affine z = x;
+			z.x0 = add(x.x0, y, z.err);
+			return z;
+		}
+
+		friend constexpr affine operator+(const T &x, const affine &y)
+		{
+			return y + x;
+		}
+
+		friend constexpr affine operator-(const affine &x)
+		{
+			affine z = x;
+			z.x0 = -x.x0;
+			for(::std::size_t i = 0; i < N; ++i)
+				z.x[i] = -x.x[i];
+			return z;
+		}
+
+		friend constexpr affine operator-(const affine &x, const affine &y)
+		{
+			return x + -y;
+		}
+
+		friend constexpr affine operator-(const affine &x, const T &y)
+		{
+			return x + -y;
+		}
+
+		friend constexpr affine operator-(const T &x, const affine &y)
+		{
+			return x + -y;
+		}
+
+		// x y = x0 y0 + sum (x0 yi + y0 xi) ei + |x0| ey + |y0| ex + rad(x) rad(y),
+		// where the product of the two linear parts is bounded by the last term
+		friend constexpr affine operator*(const affine &x, const affine &y)
+		{
+			affine z;
+			z.x0 = mul(x.x0, y.x0, z.err);
+			for(::std::size_t i = 0; i < N; ++i)
+				z.x[i] = add(mul(x.x0, y.x[i], z.err), mul(y.x0, x.x[i], z.err), z.err);
+
+			T e = Trait::add_up(
+				Trait::mul_up(::sprout::fabs(x.x0), y.err),
+				Trait::mul_up(::sprout::fabs(y.x0), x.err));
+			z.err = Trait::add_up(z.err, Trait::add_up(e, Trait::mul_up(x.rad(), y.rad())));
+			return z;
+		}
+
+		friend constexpr affine operator*(const affine &x, const T &y)
+		{
+			affine z;
+			z.x0 = mul(x.x0, y, z.err);
+			for(::std::size_t i = 0; i < N; ++i)
+				z.x[i] = mul(x.x[i], y, z.err);
+			z.err = Trait::add_up(z.err, Trait::mul_up(x.err, ::sprout::fabs(y)));
+			return z;
+		}
+
+		friend constexpr affine operator*(const T &x, const affine &y)
+		{
+			return y * x;
+		}
+
+		friend constexpr affine reciprocal(const affine &x)
+		{
+			T a = x.lower(), b = x.upper();
+
+			if(a > 0.0)
+				return reciprocal_positive(x, a, b);
+			if(b < 0.0)
+				return -reciprocal_positive(-x, -b, -a);
+			throw ::std::domain_error("cti::affine: division by an affine form containing 0");
+		}
+
+		friend constexpr affine operator/(const affine &x, const affine &y)
+		{
+			return x * reciprocal(y);
+		}
+
+		friend constexpr affine operator/(const affine &x, const T &y)
+		{
+			return x * reciprocal(affine(y));
+		}
+
+		friend constexpr affine operator/(const T &x, const affine &y)
+		{
+			return reciprocal(y) * x;
+		}
+
+		// min-range approximation: with alpha = 1 / (2 sqrt(b)), sqrt(x) - alpha x
+		// is concave, at least its value at a or b, and at most 1 / (4 alpha)
+		friend constexpr affine sqrt(const affine &x)
+		{
+			T a = x.lower(), b = x.upper();
+
+			if(a < 0.0)
+				throw ::std::domain_error("cti::affine: sqrt of an affine form containing negative values");
+			if(b == 0.0)
+				return affine();
+
+			T alpha = 0.5 / Trait::sqrt_up(b);
+			T lo = detail::interval_operator_min(
+				Trait::sub_down(Trait::sqrt_down(a), Trait::mul_up(alpha, a)),
+				Trait::sub_down(Trait::sqrt_down(b), Trait::mul_up(alpha, b)));
+			T hi = Trait::div_up(0.25, alpha);
+			return linear(x, alpha, midrad(lo, hi));
+		}
+
+		friend constexpr affine square(const affine &x)
+		{
+			return x * x;
+		}
+
+		constexpr affine &operator+=(const affine &x)
+		{
+			return *this = *this + x;
+		}
+
+		constexpr affine &operator-=(const affine &x)
+		{
+			return *this = *this - x;
+		}
+
+		constexpr affine &operator*=(const affine &x)
+		{
+			return *this = *this * x;
+		}
+
+		constexpr affine &operator/=(const affine &x)
+		{
+			return *this = *this / x;
+		}
+	};
+
+	template <typename T>
+	struct is_affine : ::std::false_type{
+	};
+
+	template <typename T, ::std::size_t N, typename Trait>
+	struct is_affine<affine<T, N, Trait>> : ::std::true_type{
+	};
+
+	template <typename T>
+	constexpr bool is_affine_v = is_affine<T>{};
+}
+
+// the cti::interval enclosing a constexpr value x with lower() and upper(),
+// such as an affine, rinterval or mrinterval
+#define CTI_TO_INTERVAL(x) ::cti::interval<CTI_DOUBLE((x).lower()), CTI_DOUBLE((x).upper())>
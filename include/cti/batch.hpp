@@ -0,0 +1,806 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+// the AVX-512 intrinsics of GCC start from deliberately uninitialized
+// vectors (_mm512_undefined_pd) and warn once inlined into the kernels
+# if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wuninitialized"
+#  pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+# endif
+# include <immintrin.h>
+# if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic pop
+# endif
+#endif
+
+#if defined(__FMA__) || defined(__AVX512F__)
+# define CTI_BATCH_FMA
+#endif
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+
+namespace cti{
+	// runtime batch of N intervals stored as separate arrays of lower and
+	// upper bounds.
+	//
+	// the kernels are vectorized versions of the algorithms in
+	// trait<double> (twosum, twoproduct, succ, pred) and never touch the
+	// rounding mode.  every lane follows exactly the same sequence of
+	// operations as the scalar code, so the results are bit-identical to
+	// trait<double> and detail::interval_operator_*_impl.  as with the
+	// scalar code, the compiler must not contract a * b + c into an fma
+	// (-ffp-contract=off); explicit fma is used for the error term of
+	// twoproduct when available, as in fma_trait.
+	template <::std::size_t N>
+	struct batch_interval{
+		static_assert(N > 0, "cti::batch_interval must contain at least one interval");
+
+		using value_type = double;
+
+		alignas(64) double inf[N];
+		alignas(64) double sup[N];
+
+		static constexpr ::std::size_t size()
+		{
+			return N;
+		}
+	};
+
+	namespace detail{
+		namespace simd{
+#if defined(__AVX512F__)
+			struct avx512{
+				using vec = __m512d;
+				using mask = __mmask8;
+
+				static constexpr ::std::size_t width = 8;
+
+				static vec load(const double *p){ return _mm512_loadu_pd(p); }
+				static void store(double *p, vec x){ _mm512_storeu_pd(p, x); }
+				static vec set1(double x){ return _mm512_set1_pd(x); }
+
+				static vec add(vec x, vec y){ return _mm512_add_pd(x, y); }
+				static vec sub(vec x, vec y){ return _mm512_sub_pd(x, y); }
+				static vec mul(vec x, vec y){ return _mm512_mul_pd(x, y); }
+				static vec div(vec x, vec y){ return _mm512_div_pd(x, y); }
+				static vec sqrt(vec x){ return _mm512_sqrt_pd(x); }
+				static vec fms(vec x, vec y, vec z){ return _mm512_fmsub_pd(x, y, z); }
+				static vec abs(vec x){ return _mm512_abs_pd(x); }
+				static vec neg(vec x){ return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(x), _mm512_set1_epi64(INT64_MIN))); }
+
+				static mask eq(vec x, vec y){ return _mm512_cmp_pd_mask(x, y, _CMP_EQ_OQ); }
+				static mask ne(vec x, vec y){ return _mm512_cmp_pd_mask(x, y, _CMP_NEQ_UQ); }
+				static mask lt(vec x, vec y){ return _mm512_cmp_pd_mask(x, y, _CMP_LT_OQ); }
+				static mask le(vec x, vec y){ return _mm512_cmp_pd_mask(x, y, _CMP_LE_OQ); }
+				static mask gt(vec x, vec y){ return _mm512_cmp_pd_mask(x, y, _CMP_GT_OQ); }
+				static mask ge(vec x, vec y){ return _mm512_cmp_pd_mask(x, y, _CMP_GE_OQ); }
+
+				static mask and_(mask x, mask y){ return x & y; }
+				static mask or_(mask x, mask y){ return x | y; }
+				static mask andnot(mask x, mask y){ return ~x & y; }
+				static unsigned bits(mask x){ return x; }
+
+				// m ? x : y
+				static vec select(mask m, vec x, vec y){ return _mm512_mask_blend_pd(m, y, x); }
+			};
+#endif
+
+#if defined(__AVX2__)
+			struct avx2{
+				using vec = __m256d;
+				using mask = __m256d;
+
+				static constexpr ::std::size_t width = 4;
+
+				static vec load(const double *p){ return _mm256_loadu_pd(p); }
+				static void store(double *p, vec x){ _mm256_storeu_pd(p, x); }
+				static vec set1(double x){ return _mm256_set1_pd(x); }
+
+				static vec add(vec x, vec y){ return _mm256_add_pd(x, y); }
+				static vec sub(vec x, vec y){ return _mm256_sub_pd(x, y); }
+				static vec mul(vec x, vec y){ return _mm256_mul_pd(x, y); }
+				static vec div(vec x, vec y){ return _mm256_div_pd(x, y); }
+				static vec sqrt(vec x){ return _mm256_sqrt_pd(x); }
+#if defined(CTI_BATCH_FMA)
+				static vec fms(vec x, vec y, vec z){ return _mm256_fmsub_pd(x, y, z); }
+#endif
+				static vec abs(vec x){ return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x); }
+				static vec neg(vec x){ return _mm256_xor_pd(_mm256_set1_pd(-0.0), x); }
+
+				static mask eq(vec x, vec y){ return _mm256_cmp_pd(x, y, _CMP_EQ_OQ); }
+				static mask ne(vec x, vec y){ return _mm256_cmp_pd(x, y, _CMP_NEQ_UQ); }
+				static mask lt(vec x, vec y){ return _mm256_cmp_pd(x, y, _CMP_LT_OQ); }
+				static mask le(vec x, vec y){ return _mm256_cmp_pd(x, y, _CMP_LE_OQ); }
+				static mask gt(vec x, vec y){ return _mm256_cmp_pd(x, y, _CMP_GT_OQ); }
+				static mask ge(vec x, vec y){ return _mm256_cmp_pd(x, y, _CMP_GE_OQ); }
+
+				static mask and_(mask x, mask y){ return _mm256_and_pd(x, y); }
+				static mask or_(mask x, mask y){ return _mm256_or_pd(x, y); }
+				static mask andnot(mask x, mask y){ return _mm256_andnot_pd(x, y); }
+				static unsigned bits(mask x){ return static_cast<unsigned>(_mm256_movemask_pd(x)); }
+
+				// m ? x : y
+				static vec select(mask m, vec x, vec y){ return _mm256_blendv_pd(y, x, m); }
+			};
+#endif
+
+#if defined(__AVX512F__)
+			using native = avx512;
+# define CTI_BATCH_SIMD
+#elif defined(__AVX2__)
+			using native = avx2;
+# define CTI_BATCH_SIMD
+#endif
+		}
+
+		// lane-wise counterpart of trait<double>.  the branches of the scalar
+		// code are evaluated on every lane and merged with select().
+		template <typename V>
+		struct batch_trait{
+			using vec = typename V::vec;
+			using mask = typename V::mask;
+
+			static vec succ(vec x)
+			{
+				constexpr double th1 = ::sprout::ldexp(1.0, -969);
+				constexpr double th2 = ::sprout::ldexp(1.0, -1021);
+				constexpr double c1 = ::sprout::ldexp(1.0, -53) + ::sprout::ldexp(1.0, -105);
+				constexpr double c2 = ::std::numeric_limits<double>::denorm_min();
+				constexpr double c3 = ::sprout::ldexp(1.0, 53);
+				constexpr double c4 = ::sprout::ldexp(1.0, -53);
+
+				vec a = V::abs(x);
+				vec c = V::mul(V::set1(c3), x);
+				vec e = V::mul(V::set1(c1), V::abs(c));
+
+				vec r = V::mul(V::add(c, e), V::set1(c4));
+				r = V::select(V::lt(a, V::set1(th2)), V::add(x, V::set1(c2)), r);
+				return V::select(V::ge(a, V::set1(th1)), V::add(x, V::mul(a, V::set1(c1))), r);
+			}
+
+			static vec pred(vec x)
+			{
+				constexpr double th1 = ::sprout::ldexp(1.0, -969);
+				constexpr double th2 = ::sprout::ldexp(1.0, -1021);
+				constexpr double c1 = ::sprout::ldexp(1.0, -53) + ::sprout::ldexp(1.0, -105);
+				constexpr double c2 = ::std::numeric_limits<double>::denorm_min();
+				constexpr double c3 = ::sprout::ldexp(1.0, 53);
+				constexpr double c4 = ::sprout::ldexp(1.0, -53);
+
+				vec a = V::abs(x);
+				vec c = V::mul(V::set1(c3), x);
+				vec e = V::mul(V::set1(c1), V::abs(c));
+
+				vec r = V::mul(V::sub(c, e), V::set1(c4));
+				r = V::select(V::lt(a, V::set1(th2)), V::sub(x, V::set1(c2)), r);
+				return V::select(V::ge(a, V::set1(th1)), V::sub(x, V::mul(a, V::set1(c1))), r);
+			}
+
+			static void twosum(vec a, vec b, vec &x, vec &y)
+			{
+				mask m = V::gt(V::abs(a), V::abs(b));
+
+				x = V::add(a, b);
+				vec tmp = V::sub(x, V::select(m, a, b));
+				y = V::sub(V::select(m, b, a), tmp);
+			}
+
+			static void split(vec a, vec &x, vec &y)
+			{
+				constexpr double sigma = ::sprout::ldexp(1.0, 27) + 1.0;
+
+				vec tmp = V::mul(a, V::set1(sigma));
+				x = V::sub(tmp, V::sub(tmp, a));
+				y = V::sub(a, x);
+			}
+
+			static void twoproduct(vec a, vec b, vec &x, vec &y)
+			{
+#if defined(CTI_BATCH_FMA)
+				// same error term as the splitting below (see fma_trait)
+				x = V::mul(a, b);
+				y = V::fms(a, b, x);
+#else
+				constexpr double th = ::sprout::ldexp(1.0, 996);
+				constexpr double c1 = ::sprout::ldexp(1.0, -28);
+				constexpr double c2 = ::sprout::ldexp(1.0, 28);
+				constexpr double th2 = ::sprout::ldexp(1.0, 1023);
+				constexpr double half = 0.5;
+				constexpr double two = 2.0;
+
+				x = V::mul(a, b);
+
+				mask ma = V::gt(V::abs(a), V::set1(th));
+				mask mb = V::andnot(ma, V::gt(V::abs(b), V::set1(th)));
+
+				vec na = V::select(ma, V::mul(a, V::set1(c1)), V::select(mb, V::mul(a, V::set1(c2)), a));
+				vec nb = V::select(ma, V::mul(b, V::set1(c2)), V::select(mb, V::mul(b, V::set1(c1)), b));
+
+				vec a1, a2, b1, b2;
+				split(na, a1, a2);
+				split(nb, b1, b2);
+
+				vec big = V::sub(V::sub(V::mul(V::sub(V::mul(x, V::set1(half)), V::mul(V::mul(a1, V::set1(half)), b1)), V::set1(two)), V::mul(a2, b1)), V::mul(a1, b2));
+				vec normal = V::sub(V::sub(V::sub(x, V::mul(a1, b1)), V::mul(a2, b1)), V::mul(a1, b2));
+
+				y = V::sub(V::mul(a2, b2), V::select(V::gt(V::abs(x), V::set1(th2)), big, normal));
+#endif
+			}
+
+			static vec add_up(vec x, vec y)
+			{
+				constexpr double inf = ::std::numeric_limits<double>::infinity();
+				constexpr double max = ::std::numeric_limits<double>::max();
+
+				vec r, r2;
+				twosum(x, y, r, r2);
+
+				vec result = V::select(V::gt(r2, V::set1(0.0)), succ(r), r);
+
+				mask exact = V::or_(V::eq(x, V::set1(-inf)), V::eq(y, V::set1(-inf)));
+				result = V::select(V::eq(r, V::set1(-inf)), V::select(exact, r, V::set1(-max)), result);
+				return V::select(V::eq(r, V::set1(inf)), r, result);
+			}
+
+			static vec add_down(vec x, vec y)
+			{
+				constexpr double inf = ::std::numeric_limits<double>::infinity();
+				constexpr double max = ::std::numeric_limits<double>::max();
+
+				vec r, r2;
+				twosum(x, y, r, r2);
+
+				vec result = V::select(V::lt(r2, V::set1(0.0)), pred(r), r);
+
+				mask exact = V::or_(V::eq(x, V::set1(inf)), V::eq(y, V::set1(inf)));
+				result = V::select(V::eq(r, V::set1(-inf)), r, result);
+				return V::select(V::eq(r, V::set1(inf)), V::select(exact, r, V::set1(max)), result);
+			}
+
+			static vec sub_up(vec x, vec y)
+			{
+				constexpr double inf = ::std::numeric_limits<double>::infinity();
+				constexpr double max = ::std::numeric_limits<double>::max();
+
+				vec r, r2;
+				twosum(x, V::neg(y), r, r2);
+
+				vec result = V::select(V::gt(r2, V::set1(0.0)), succ(r), r);
+
+				mask exact = V::or_(V::eq(x, V::set1(-inf)), V::eq(y, V::set1(inf)));
+				result = V::select(V::eq(r, V::set1(-inf)), V::select(exact, r, V::set1(-max)), result);
+				return V::select(V::eq(r, V::set1(inf)), r, result);
+			}
+
+			static vec sub_down(vec x, vec y)
+			{
+				constexpr double inf = ::std::numeric_limits<double>::infinity();
+				constexpr double max = ::std::numeric_limits<double>::max();
+
+				vec r, r2;
+				twosum(x, V::neg(y), r, r2);
+
+				vec result = V::select(V::lt(r2, V::set1(0.0)), pred(r), r);
+
+				mask exact = V::or_(V::eq(x, V::set1(inf)), V::eq(y, V::set1(-inf)));
+				result = V::select(V::eq(r, V::set1(-inf)), r, result);
+				return V::select(V::eq(r, V::set1(inf)), V::select(exact, r, V::set1(max)), result);
+			}
+
+			static vec mul_up(vec x, vec y)
+			{
+				constexpr double inf = ::std::numeric_limits<double>::infinity();
+				constexpr double max = ::std::numeric_limits<double>::max();
+				constexpr double th = ::sprout::ldexp(1.0, -969);
+				constexpr double c = ::sprout::ldexp(1.0, 537);
+
+				vec r, r2;
+				twoproduct(x, y, r, r2);
+
+				mask normal = V::ge(V::abs(r), V::set1(th));
+				mask up = V::and_(normal, V::gt(r2, V::set1(0.0)));
+
+				// the rescaled product is only needed for tiny results
+				if(V::bits(normal) != (1u << V::width) - 1){
+					vec s, s2;
+					twoproduct(V::mul(x, V::set1(c)), V::mul(y, V::set1(c)), s, s2);
+					vec t = V::mul(V::mul(r, V::set1(c)), V::set1(c));
+
+					up = V::or_(up, V::andnot(normal,
+						V::or_(V::lt(t, s), V::and_(V::eq(t, s), V::gt(s2, V::set1(0.0))))));
+				}
+
+				vec result = V::select(up, succ(r), r);
+
+				mask exact = V::or_(V::eq(V::abs(x), V::set1(inf)), V::eq(V::abs(y), V::set1(inf)));
+				result = V::select(V::eq(r, V::set1(-inf)), V::select(exact, r, V::set1(-max)), result);
+				return V::select(V::eq(r, V::set1(inf)), r, result);
+			}
+
+			static vec mul_down(vec x, vec y)
+			{
+				constexpr double inf = ::std::numeric_limits<double>::infinity();
+				constexpr double max = ::std::numeric_limits<double>::max();
+				constexpr double th = ::sprout::ldexp(1.0, -969);
+				constexpr double c = ::sprout::ldexp(1.0, 537);
+
+				vec r, r2;
+				twoproduct(x, y, r, r2);
+
+				mask normal = V::ge(V::abs(r), V::set1(th));
+				mask down = V::and_(normal, V::lt(r2, V::set1(0.0)));
+
+				// the rescaled product is only needed for tiny results
+				if(V::bits(normal) != (1u << V::width) - 1){
+					vec s, s2;
+					twoproduct(V::mul(x, V::set1(c)), V::mul(y, V::set1(c)), s, s2);
+					vec t = V::mul(V::mul(r, V::set1(c)), V::set1(c));
+
+					down = V::or_(down, V::andnot(normal,
+						V::or_(V::gt(t, s), V::and_(V::eq(t, s), V::lt(s2, V::set1(0.0))))));
+				}
+
+				vec result = V::select(down, pred(r), r);
+
+				mask exact = V::or_(V::eq(V::abs(x), V::set1(inf)), V::eq(V::abs(y), V::set1(inf)));
+				result = V::select(V::eq(r, V::set1(-inf)), r, result);
+				return V::select(V::eq(r, V::set1(inf)), V::select(exact, r, V::set1(max)), result);
+			}
+
+			// lanes for which div_up/div_down return x / y unchanged
+			static mask div_trivial(vec x, vec y)
+			{
+				constexpr double zero = 0.0;
+				constexpr double inf = ::std::numeric_limits<double>::infinity();
+
+				return V::or_(
+					V::or_(V::eq(x, V::set1(zero)), V::eq(y, V::set1(zero))),
+					V::or_(
+						V::or_(V::eq(V::abs(x), V::set1(inf)), V::eq(V::abs(y), V::set1(inf))),
+						V::or_(V::ne(x, x), V::ne(y, y))));
+			}
+
+			static vec div_up(vec x, vec y)
+			{
+				constexpr double zero = 0.0;
+				constexpr double inf = ::std::numeric_limits<double>::infinity();
+				constexpr double max = ::std::numeric_limits<double>::max();
+				constexpr double th1 = ::sprout::ldexp(1.0, -969);
+				constexpr double th2 = ::sprout::ldexp(1.0, 918);
+				constexpr double c1 = ::sprout::ldexp(1.0, 105);
+				constexpr double c2 = ::std::numeric_limits<double>::denorm_min();
+
+				mask negative = V::lt(y, V::set1(zero));
+				vec xn = V::select(negative, V::neg(x), x);
+				vec yn = V::select(negative, V::neg(y), y);
+
+				mask tiny = V::lt(V::abs(xn), V::set1(th1));
+				mask scale = V::and_(tiny, V::lt(V::abs(yn), V::set1(th2)));
+				mask underflow = V::andnot(scale, tiny);
+
+				xn = V::select(scale, V::mul(xn, V::set1(c1)), xn);
+				yn = V::select(scale, V::mul(yn, V::set1(c1)), yn);
+
+				vec d = V::div(xn, yn);
+
+				vec r, r2;
+				twoproduct(d, yn, r, r2);
+
+				mask up = V::or_(V::lt(r, xn), V::and_(V::eq(r, xn), V::lt(r2, V::set1(zero))));
+				vec result = V::select(up, succ(d), d);
+
+				result = V::select(V::eq(d, V::set1(-inf)), V::set1(-max), result);
+				result = V::select(V::eq(d, V::set1(inf)), d, result);
+				result = V::select(underflow, V::select(V::lt(xn, V::set1(zero)), V::set1(zero), V::set1(c2)), result);
+				return V::select(div_trivial(x, y), V::div(x, y), result);
+			}
+
+			static vec div_down(vec x, vec y)
+			{
+				constexpr double zero = 0.0;
+				constexpr double inf = ::std::numeric_limits<double>::infinity();
+				constexpr double max = ::std::numeric_limits<double>::max();
+				constexpr double th1 = ::sprout::ldexp(1.0, -969);
+				constexpr double th2 = ::sprout::ldexp(1.0, 918);
+				constexpr double c1 = ::sprout::ldexp(1.0, 105);
+				constexpr double c2 = ::std::numeric_limits<double>::denorm_min();
+
+				mask negative = V::lt(y, V::set1(zero));
+				vec xn = V::select(negative, V::neg(x), x);
+				vec yn = V::select(negative, V::neg(y), y);
+
+				mask tiny = V::lt(V::abs(xn), V::set1(th1));
+				mask scale = V::and_(tiny, V::lt(V::abs(yn), V::set1(th2)));
+				mask underflow = V::andnot(scale, tiny);
+
+				xn = V::select(scale, V::mul(xn, V::set1(c1)), xn);
+				yn = V::select(scale, V::mul(yn, V::set1(c1)), yn);
+
+				vec d = V::div(xn, yn);
+
+				vec r, r2;
+				twoproduct(d, yn, r, r2);
+
+				mask down = V::or_(V::gt(r, xn), V::and_(V::eq(r, xn), V::gt(r2, V::set1(zero))));
+				vec result = V::select(down, pred(d), d);
+
+				result = V::select(V::eq(d, V::set1(-inf)), d, result);
+				result = V::select(V::eq(d, V::set1(inf)), V::set1(max), result);
+				result = V::select(underflow, V::select(V::lt(x, V::set1(zero)), V::set1(-c2), V::set1(zero)), result);
+				return V::select(div_trivial(x, y), V::div(x, y), result);
+			}
+
+			static vec sqrt_up(vec x)
+			{
+				constexpr double th1 = ::sprout::ldexp(1.0, -969);
+				constexpr double c1 = ::sprout::ldexp(1.0, 106);
+				constexpr double c2 = ::sprout::ldexp(1.0, 53);
+
+				vec d = V::sqrt(x);
+
+				mask tiny = V::lt(x, V::set1(th1));
+				vec xs = V::select(tiny, V::mul(x, V::set1(c1)), x);
+				vec ds = V::select(tiny, V::mul(d, V::set1(c2)), d);
+
+				vec r, r2;
+				twoproduct(ds, ds, r, r2);
+
+				mask up = V::or_(V::lt(r, xs), V::and_(V::eq(r, xs), V::lt(r2, V::set1(0.0))));
+				return V::select(up, succ(d), d);
+			}
+
+			static vec sqrt_down(vec x)
+			{
+				constexpr double th1 = ::sprout::ldexp(1.0, -969);
+				constexpr double c1 = ::sprout::ldexp(1.0, 106);
+				constexpr double c2 = ::sprout::ldexp(1.0, 53);
+
+				vec d = V::sqrt(x);
+
+				mask tiny = V::lt(x, V::set1(th1));
+				vec xs = V::select(tiny, V::mul(x, V::set1(c1)), x);
+				vec ds = V::select(tiny, V::mul(d, V::set1(c2)), d);
+
+				vec r, r2;
+				twoproduct(ds, ds, r, r2);
+
+				mask down = V::or_(V::gt(r, xs), V::and_(V::eq(r, xs), V::gt(r2, V::set1(0.0))));
+				return V::select(down, pred(d), d);
+			}
+		};
+
+		// kernels over arrays of n intervals.  the remainder that does not fill
+		// a whole vector and the lanes that the scalar code treats specially
+		// (multiplication by [0,0], division by an interval containing 0) are
+		// computed with the scalar code.  sqrt throws on a negative lower
+		// bound, as the scalar code does.
+		template <typename V>
+		struct batch_kernel{
+			using vec = typename V::vec;
+			using mask = typename V::mask;
+			using bt = batch_trait<V>;
+
+			static constexpr ::std::size_t width = V::width;
+
+			static ::std::size_t add(::std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+			{
+				::std::size_t i = 0;
+
+				for(; i + width <= n; i += width){
+					vec lower = bt::add_down(V::load(inf1 + i), V::load(inf2 + i));
+					vec upper = bt::add_up(V::load(sup1 + i), V::load(sup2 + i));
+					V::store(inf + i, lower);
+					V::store(sup + i, upper);
+				}
+
+				return i;
+			}
+
+			static ::std::size_t sub(::std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+			{
+				::std::size_t i = 0;
+
+				for(; i + width <= n; i += width){
+					vec lower = bt::sub_down(V::load(inf1 + i), V::load(sup2 + i));
+					vec upper = bt::sub_up(V::load(sup1 + i), V::load(inf2 + i));
+					V::store(inf + i, lower);
+					V::store(sup + i, upper);
+				}
+
+				return i;
+			}
+
+			static ::std::size_t mul(mul_by_cases, ::std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+			{
+				constexpr double zero = 0.0;
+
+				const mask ones = V::eq(V::set1(zero), V::set1(zero));
+
+				::std::size_t i = 0;
+
+				for(; i + width <= n; i += width){
+					vec i1 = V::load(inf1 + i), s1 = V::load(sup1 + i);
+					vec i2 = V::load(inf2 + i), s2 = V::load(sup2 + i);
+
+					// sign classes in the order they are tested by
+					// interval_operator_mul_impl1
+					mask p1 = V::ge(i1, V::set1(zero));
+					mask n1 = V::andnot(p1, V::le(s1, V::set1(zero)));
+					mask m1 = V::andnot(V::or_(p1, n1), ones);
+					mask p2 = V::ge(i2, V::set1(zero));
+					mask n2 = V::andnot(p2, V::le(s2, V::set1(zero)));
+					mask m2 = V::andnot(V::or_(p2, n2), ones);
+
+					mask special = V::or_(V::and_(p1, V::eq(s1, V::set1(zero))), V::and_(p2, V::eq(s2, V::set1(zero))));
+
+					// PN, PM, NN, MN take sup1 for the lower bound
+					mask lower_a = V::or_(V::and_(p1, V::or_(n2, m2)), V::and_(n2, V::or_(n1, m1)));
+					// NP, NN, NM, MP, MM take sup2 for the lower bound
+					mask lower_b = V::or_(n1, V::and_(m1, V::or_(p2, m2)));
+					// PN, NN, NM, MN, MM take inf1 for the upper bound
+					mask upper_a = V::or_(n2, V::andnot(p1, m2));
+					// NP, NN, NM, MN, MM take inf2 for the upper bound
+					mask upper_b = V::or_(n1, V::and_(m1, V::or_(n2, m2)));
+
+					vec lower = bt::mul_down(V::select(lower_a, s1, i1), V::select(lower_b, s2, i2));
+					vec upper = bt::mul_up(V::select(upper_a, i1, s1), V::select(upper_b, i2, s2));
+
+					mask mm = V::and_(m1, m2);
+					if(V::bits(mm) != 0){
+						vec lower2 = bt::mul_down(s1, i2);
+						vec upper2 = bt::mul_up(s1, s2);
+						lower = V::select(V::and_(mm, V::lt(lower2, lower)), lower2, lower);
+						upper = V::select(V::and_(mm, V::gt(upper2, upper)), upper2, upper);
+					}
+
+					V::store(inf + i, lower);
+					V::store(sup + i, upper);
+
+					unsigned bits = V::bits(special);
+					for(::std::size_t j = 0; bits != 0; ++j, bits >>= 1){
+						if(bits & 1u){
+							auto result = interval_operator_mul_impl1(inf1[i + j], sup1[i + j], inf2[i + j], sup2[i + j]);
+							inf[i + j] = ::std::get<0>(result);
+							sup[i + j] = ::std::get<1>(result);
+						}
+					}
+				}
+
+				return i;
+			}
+
+			// zero operands are masked so that 0 * inf is 0, as in
+			// interval_operator_mul_impl1_minmax
+			static vec mul_down0(vec x, vec y)
+			{
+				constexpr double zero = 0.0;
+
+				mask m = V::or_(V::eq(x, V::set1(zero)), V::eq(y, V::set1(zero)));
+				return V::select(m, V::set1(zero), bt::mul_down(x, y));
+			}
+
+			static vec mul_up0(vec x, vec y)
+			{
+				constexpr double zero = 0.0;
+
+				mask m = V::or_(V::eq(x, V::set1(zero)), V::eq(y, V::set1(zero)));
+				return V::select(m, V::set1(zero), bt::mul_up(x, y));
+			}
+
+			static vec min(vec x, vec y)
+			{
+				return V::select(V::lt(y, x), y, x);
+			}
+
+			static vec max(vec x, vec y)
+			{
+				return V::select(V::gt(y, x), y, x);
+			}
+
+			static ::std::size_t mul(mul_by_minmax, ::std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+			{
+				constexpr double zero = 0.0;
+				constexpr double infinity = ::std::numeric_limits<double>::infinity();
+
+				::std::size_t i = 0;
+
+				for(; i + width <= n; i += width){
+					vec i1 = V::load(inf1 + i), s1 = V::load(sup1 + i);
+					vec i2 = V::load(inf2 + i), s2 = V::load(sup2 + i);
+
+					vec lower = min(min(mul_down0(i1, i2), mul_down0(i1, s2)), min(mul_down0(s1, i2), mul_down0(s1, s2)));
+					vec upper = max(max(mul_up0(i1, i2), mul_up0(i1, s2)), max(mul_up0(s1, i2), mul_up0(s1, s2)));
+
+					mask zero1 = V::and_(V::ge(i1, V::set1(zero)), V::eq(s1, V::set1(zero)));
+					mask zero2 = V::and_(V::ge(i2, V::set1(zero)), V::eq(s2, V::set1(zero)));
+					mask unbounded1 = V::or_(V::eq(V::abs(i1), V::set1(infinity)), V::eq(V::abs(s1), V::set1(infinity)));
+					mask unbounded2 = V::or_(V::eq(V::abs(i2), V::set1(infinity)), V::eq(V::abs(s2), V::set1(infinity)));
+					mask whole = V::or_(V::and_(zero1, unbounded2), V::and_(zero2, unbounded1));
+
+					V::store(inf + i, V::select(whole, V::set1(-infinity), lower));
+					V::store(sup + i, V::select(whole, V::set1(infinity), upper));
+				}
+
+				return i;
+			}
+
+			static ::std::size_t div(::std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+			{
+				constexpr double zero = 0.0;
+
+				const mask ones = V::eq(V::set1(zero), V::set1(zero));
+
+				::std::size_t i = 0;
+
+				for(; i + width <= n; i += width){
+					vec i1 = V::load(inf1 + i), s1 = V::load(sup1 + i);
+					vec i2 = V::load(inf2 + i), s2 = V::load(sup2 + i);
+
+					mask p1 = V::ge(i1, V::set1(zero));
+					mask n1 = V::andnot(p1, V::le(s1, V::set1(zero)));
+					mask positive = V::gt(i2, V::set1(zero));
+					mask negative = V::andnot(positive, V::lt(s2, V::set1(zero)));
+
+					// the numerator is inf1/sup1 for a positive divisor and
+					// sup1/inf1 for a negative one
+					vec lower_a = V::select(positive, i1, s1);
+					vec upper_a = V::select(positive, s1, i1);
+					vec lower_b = V::select(V::or_(V::and_(positive, p1), V::andnot(V::or_(positive, n1), ones)), s2, i2);
+					vec upper_b = V::select(V::or_(n1, V::andnot(V::or_(positive, p1), negative)), s2, i2);
+
+					V::store(inf + i, bt::div_down(lower_a, lower_b));
+					V::store(sup + i, bt::div_up(upper_a, upper_b));
+
+					unsigned bits = ~V::bits(V::or_(positive, negative)) & ((1u << width) - 1);
+					for(::std::size_t j = 0; bits != 0; ++j, bits >>= 1){
+						if(bits & 1u){
+							auto result = interval_operator_div_impl1(inf1[i + j], sup1[i + j], inf2[i + j], sup2[i + j]);
+							inf[i + j] = ::std::get<0>(result);
+							sup[i + j] = ::std::get<1>(result);
+						}
+					}
+				}
+
+				return i;
+			}
+
+			static ::std::size_t sqrt(::std::size_t n, const double *inf1, const double *sup1, double *inf, double *sup)
+			{
+				constexpr double zero = 0.0;
+
+				::std::size_t i = 0;
+
+				for(; i + width <= n; i += width){
+					vec i1 = V::load(inf1 + i);
+
+					if(V::bits(V::ge(i1, V::set1(zero))) != (1u << width) - 1)
+						throw ::std::domain_error("cti::batch_interval: sqrt of negative value");
+
+					V::store(inf + i, bt::sqrt_down(i1));
+					V::store(sup + i, bt::sqrt_up(V::load(sup1 + i)));
+				}
+
+				return i;
+			}
+		};
+
+		inline void batch_add(::std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+		{
+			::std::size_t i = 0;
+#if defined(CTI_BATCH_SIMD)
+			i = batch_kernel<simd::native>::add(n, inf1, sup1, inf2, sup2, inf, sup);
+#endif
+			for(; i < n; ++i){
+				double lower = trait<double>::add_down(inf1[i], inf2[i]);
+				double upper = trait<double>::add_up(sup1[i], sup2[i]);
+				inf[i] = lower;
+				sup[i] = upper;
+			}
+		}
+
+		inline void batch_sub(::std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+		{
+			::std::size_t i = 0;
+#if defined(CTI_BATCH_SIMD)
+			i = batch_kernel<simd::native>::sub(n, inf1, sup1, inf2, sup2, inf, sup);
+#endif
+			for(; i < n; ++i){
+				double lower = trait<double>::sub_down(inf1[i], sup2[i]);
+				double upper = trait<double>::sub_up(sup1[i], inf2[i]);
+				inf[i] = lower;
+				sup[i] = upper;
+			}
+		}
+
+		template <typename Policy = mul_by_cases>
+		void batch_mul(::std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+		{
+			::std::size_t i = 0;
+#if defined(CTI_BATCH_SIMD)
+			i = batch_kernel<simd::native>::mul(Policy{}, n, inf1, sup1, inf2, sup2, inf, sup);
+#endif
+			for(; i < n; ++i){
+				auto result = Policy::template apply<double>(inf1[i], sup1[i], inf2[i], sup2[i]);
+				inf[i] = ::std::get<0>(result);
+				sup[i] = ::std::get<1>(result);
+			}
+		}
+
+		inline void batch_div(::std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+		{
+			::std::size_t i = 0;
+#if defined(CTI_BATCH_SIMD)
+			i = batch_kernel<simd::native>::div(n, inf1, sup1, inf2, sup2, inf, sup);
+#endif
+			for(; i < n; ++i){
+				auto result = interval_operator_div_impl1(inf1[i], sup1[i], inf2[i], sup2[i]);
+				inf[i] = ::std::get<0>(result);
+				sup[i] = ::std::get<1>(result);
+			}
+		}
+
+		inline void batch_sqrt(::std::size_t n, const double *inf1, const double *sup1, double *inf, double *sup)
+		{
+			::std::size_t i = 0;
+#if defined(CTI_BATCH_SIMD)
+			i = batch_kernel<simd::native>::sqrt(n, inf1, sup1, inf, sup);
+#endif
+			for(; i < n; ++i){
+				if(!(inf1[i] >= 0.0))
+					throw ::std::domain_error("cti::batch_interval: sqrt of negative value");
+
+				double lower = trait<double>::sqrt_down(inf1[i]);
+				double upper = trait<double>::sqrt_up(sup1[i]);
+				inf[i] = lower;
+				sup[i] = upper;
+			}
+		}
+	}
+
+	template <::std::size_t N>
+	batch_interval<N> operator+(const batch_interval<N> &x, const batch_interval<N> &y)
+	{
+		batch_interval<N> z;
+		detail::batch_add(N, x.inf, x.sup, y.inf, y.sup, z.inf, z.sup);
+		return z;
+	}
+
+	template <::std::size_t N>
+	batch_interval<N> operator-(const batch_interval<N> &x, const batch_interval<N> &y)
+	{
+		batch_interval<N> z;
+		detail::batch_sub(N, x.inf, x.sup, y.inf, y.sup, z.inf, z.sup);
+		return z;
+	}
+
+	template <::std::size_t N>
+	batch_interval<N> operator*(const batch_interval<N> &x, const batch_interval<N> &y)
+	{
+		batch_interval<N> z;
+		detail::batch_mul<>(N, x.inf, x.sup, y.inf, y.sup, z.inf, z.sup);
+		return z;
+	}
+
+	template <::std::size_t N>
+	batch_interval<N> operator/(const batch_interval<N> &x, const batch_interval<N> &y)
+	{
+		batch_interval<N> z;
+		detail::batch_div(N, x.inf, x.sup, y.inf, y.sup, z.inf, z.sup);
+		return z;
+	}
+
+	template <::std::size_t N>
+	batch_interval<N> sqrt(const batch_interval<N> &x)
+	{
+		batch_interval<N> z;
+		detail::batch_sqrt(N, x.inf, x.sup, z.inf, z.sup);
+		return z;
+	}
+}
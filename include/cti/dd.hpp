@@ -0,0 +1,477 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <tuple>
+
+#include <sprout/math/fabs.hpp>
+#include <sprout/math/ldexp.hpp>
+
+#include <kv/interval.hpp>
+#include <kv/dd.hpp>
+#include <kv/rdd.hpp>
+
+#include <cti/decimal.hpp>
+#include <cti/double.hpp>
+#include <cti/interval.hpp>
+#include <cti/literals.hpp>
+#include <cti/rdouble.hpp>
+
+namespace cti{
+	// double-double number hi + lo with about 106 significant bits.  hi is
+	// the sum rounded to nearest and lo the exact remainder, so every value
+	// has a single representation and the comparisons are lexicographic.
+	// cti::interval accepts it as a bound type (see dd_ below):
+	//
+	//     using namespace cti::literals;
+	//     constexpr auto pi = 3.14159265358979323846264338327950288_ddi;
+	//     constexpr auto x = pi * pi / CTI_I(6.0){};  // bounds of type dd_<...>
+	//     constexpr cti::dd lower = x.lower();
+	//     constexpr auto y = cti::to_double(x);        // bounds of type double_<...>
+	struct dd{
+		double hi = 0.0;
+		double lo = 0.0;
+
+		constexpr dd() = default;
+
+		constexpr dd(double x)
+			: hi(x), lo(0.0)
+		{
+		}
+
+		// hi and lo must be normalized, e.g. the result of twosum
+		constexpr dd(double hi, double lo)
+			: hi(hi), lo(lo)
+		{
+		}
+
+		// the nearest double
+		explicit constexpr operator double() const
+		{
+			return hi;
+		}
+
+		friend constexpr dd operator-(const dd &x)
+		{
+			return {-x.hi, -x.lo};
+		}
+
+		friend constexpr bool operator<(const dd &x, const dd &y)
+		{
+			return x.hi < y.hi || (x.hi == y.hi && x.lo < y.lo);
+		}
+
+		friend constexpr bool operator<=(const dd &x, const dd &y)
+		{
+			return x.hi < y.hi || (x.hi == y.hi && x.lo <= y.lo);
+		}
+
+		friend constexpr bool operator>(const dd &x, const dd &y)
+		{
+			return y < x;
+		}
+
+		friend constexpr bool operator>=(const dd &x, const dd &y)
+		{
+			return y <= x;
+		}
+
+		friend constexpr bool operator==(const dd &x, const dd &y)
+		{
+			return x.hi == y.hi && x.lo == y.lo;
+		}
+
+		friend constexpr bool operator!=(const dd &x, const dd &y)
+		{
+			return !(x == y);
+		}
+	};
+
+	constexpr dd fabs(const dd &x)
+	{
+		return x.hi < 0.0 ? -x : x;
+	}
+}
+
+namespace std{
+	template <>
+	class numeric_limits<::cti::dd>{
+	public:
+		static constexpr bool is_specialized = true;
+		static constexpr bool is_signed = true;
+		static constexpr bool has_infinity = true;
+		static constexpr bool has_quiet_NaN = true;
+		static constexpr int digits = 106;
+		static constexpr int radix = 2;
+
+		static constexpr ::cti::dd min()
+		{
+			return ::std::numeric_limits<double>::min();
+		}
+
+		static constexpr ::cti::dd max()
+		{
+			return ::std::numeric_limits<double>::max();
+		}
+
+		static constexpr ::cti::dd lowest()
+		{
+			return -::std::numeric_limits<double>::max();
+		}
+
+		static constexpr ::cti::dd epsilon()
+		{
+			return ::sprout::ldexp(1.0, -105);
+		}
+
+		static constexpr ::cti::dd infinity()
+		{
+			return ::std::numeric_limits<double>::infinity();
+		}
+
+		static constexpr ::cti::dd quiet_NaN()
+		{
+			return ::std::numeric_limits<double>::quiet_NaN();
+		}
+	};
+}
+
+namespace cti{
+	// cti::dd encoded as a type by the bit patterns of hi and lo
+	template <::std::uint64_t Hi, ::std::uint64_t Lo>
+	struct dd_{
+		using type = dd_;
+		using value_type = dd;
+
+		static constexpr dd value{detail::bits_to_double(Hi), detail::bits_to_double(Lo)};
+
+		constexpr operator dd() const
+		{
+			return value;
+		}
+	};
+
+	template <::std::uint64_t Hi, ::std::uint64_t Lo>
+	constexpr dd dd_<Hi, Lo>::value;
+
+	namespace detail{
+		template <>
+		struct bound<dd>{
+			using kv_type = ::kv::dd;
+
+			template <::std::uint64_t Leading, ::std::uint64_t Trailing>
+			using type = dd_<Leading, Trailing>;
+
+			static constexpr ::std::uint64_t leading(const dd &x)
+			{
+				return double_to_bits(x.hi);
+			}
+
+			static constexpr ::std::uint64_t trailing(const dd &x)
+			{
+				return double_to_bits(x.lo);
+			}
+
+			static ::kv::dd to_kv(const dd &x)
+			{
+				return ::kv::dd(x.hi, x.lo);
+			}
+		};
+
+		constexpr bool dd_finite(double x)
+		{
+			return x == x && ::sprout::fabs(x) != ::std::numeric_limits<double>::infinity();
+		}
+
+		// directed rounding of dd built on the error-free transformations
+		// and the directed operations of the double trait Base.  every
+		// operation forms the exact result as hi + lo plus a few low-order
+		// terms, bounds the low-order sum with Base, and renormalizes with
+		// twosum, so the bounds are within a few units of 2^-106 relative.
+		// where that is not possible (overflow, infinities, and results
+		// below 2^-969, whose lo would be subnormal) the result falls back
+		// to Base on the double bounds of the operands.  the lower bounds
+		// are the negated upper bounds of the negated operands.
+		template <typename Base>
+		struct rdd_trait{
+			// the double bounds of x
+			static constexpr double lower(const dd &x)
+			{
+				return x.lo < 0.0 ? Base::pred(x.hi) : x.hi;
+			}
+
+			static constexpr double upper(const dd &x)
+			{
+				return x.lo > 0.0 ? Base::succ(x.hi) : x.hi;
+			}
+
+			static constexpr dd add_up(const dd &x, const dd &y)
+			{
+				auto s = Base::twosum(x.hi, y.hi);
+				auto t = Base::twosum(x.lo, y.lo);
+				auto u = Base::twosum(::std::get<1>(s), ::std::get<0>(t));
+				auto v = Base::twosum(::std::get<0>(s), ::std::get<0>(u));
+
+				// x + y = v0 + v1 + u1 + t1
+				double e = Base::add_up(Base::add_up(::std::get<1>(u), ::std::get<1>(t)), ::std::get<1>(v));
+				auto r = Base::twosum(::std::get<0>(v), e);
+
+				if(!dd_finite(::std::get<0>(r)))
+					return Base::add_up(upper(x), upper(y));
+
+				return {::std::get<0>(r), ::std::get<1>(r)};
+			}
+
+			static constexpr dd add_down(const dd &x, const dd &y)
+			{
+				return -add_up(-x, -y);
+			}
+
+			static constexpr dd sub_up(const dd &x, const dd &y)
+			{
+				return add_up(x, -y);
+			}
+
+			static constexpr dd sub_down(const dd &x, const dd &y)
+			{
+				return -add_up(-x, y);
+			}
+
+			static constexpr dd mul_up(const dd &x, const dd &y)
+			{
+				constexpr double th = ::sprout::ldexp(1.0, -969);
+
+				auto p = Base::twoproduct(x.hi, y.hi);
+				double p0 = ::std::get<0>(p);
+
+				// x y = p0 + p1 + x.hi y.lo + x.lo y.hi + x.lo y.lo, where p1
+				// is exact for |p0| >= 2^-969
+				if(dd_finite(p0) && ::sprout::fabs(p0) >= th){
+					double c = Base::add_up(
+						Base::add_up(Base::mul_up(x.hi, y.lo), Base::mul_up(x.lo, y.hi)),
+						Base::mul_up(x.lo, y.lo));
+					auto r = Base::twosum(p0, Base::add_up(::std::get<1>(p), c));
+
+					if(dd_finite(::std::get<0>(r)))
+						return {::std::get<0>(r), ::std::get<1>(r)};
+				}
+
+				return ::std::get<1>(interval_operator_mul_impl1<double, Base>(lower(x), upper(x), lower(y), upper(y)));
+			}
+
+			static constexpr dd mul_down(const dd &x, const dd &y)
+			{
+				return -mul_up(-x, y);
+			}
+
+			static constexpr dd div_up(const dd &x, const dd &y)
+			{
+				constexpr double th = ::sprout::ldexp(1.0, -969);
+
+				if(y.hi < 0.0)
+					return div_up(-x, -y);
+
+				double q = x.hi / y.hi;
+
+				// x / y = q + (x - q y) / y, and
+				// x - q y = (x.hi - p0) - p1 + x.lo - q y.lo
+				if(dd_finite(q) && ::sprout::fabs(x.hi) >= th && y.hi >= th){
+					auto p = Base::twoproduct(q, y.hi);
+
+					double r = Base::sub_up(x.hi, ::std::get<0>(p));
+					r = Base::sub_up(r, ::std::get<1>(p));
+					r = Base::add_up(r, x.lo);
+					r = Base::sub_up(r, Base::mul_down(q, y.lo));
+
+					auto s = Base::twosum(q, Base::div_up(r, r >= 0.0 ? lower(y) : upper(y)));
+
+					if(dd_finite(::std::get<0>(s)))
+						return {::std::get<0>(s), ::std::get<1>(s)};
+				}
+
+				if(y.hi == 0.0)
+					return x.hi / y.hi;
+
+				double b = upper(x);
+				return Base::div_up(b, b >= 0.0 ? lower(y) : upper(y));
+			}
+
+			static constexpr dd div_down(const dd &x, const dd &y)
+			{
+				return -div_up(-x, y);
+			}
+
+			// sqrt(x) = s + (x - s^2) / (sqrt(x) + s) for s = sqrt(x.hi),
+			// with the denominator bounded by the double square roots
+			static constexpr dd sqrt_up(const dd &x)
+			{
+				constexpr double th = ::sprout::ldexp(1.0, -969);
+
+				if(!dd_finite(x.hi) || x.hi < th)
+					return Base::sqrt_up(upper(x));
+
+				double s = Base::sqrt_up(x.hi);
+				auto p = Base::twoproduct(s, s);
+
+				double r = Base::sub_up(x.hi, ::std::get<0>(p));
+				r = Base::sub_up(r, ::std::get<1>(p));
+				r = Base::add_up(r, x.lo);
+
+				double d = r >= 0.0
+					? Base::add_down(s, Base::sqrt_down(lower(x)))
+					: Base::add_up(s, Base::sqrt_up(upper(x)));
+				auto t = Base::twosum(s, Base::div_up(r, d));
+
+				return {::std::get<0>(t), ::std::get<1>(t)};
+			}
+
+			static constexpr dd sqrt_down(const dd &x)
+			{
+				constexpr double th = ::sprout::ldexp(1.0, -969);
+
+				if(!dd_finite(x.hi) || x.hi < th)
+					return Base::sqrt_down(lower(x));
+
+				double s = Base::sqrt_up(x.hi);
+				auto p = Base::twoproduct(s, s);
+
+				double r = Base::sub_down(x.hi, ::std::get<0>(p));
+				r = Base::sub_down(r, ::std::get<1>(p));
+				r = Base::add_down(r, x.lo);
+
+				double d = r >= 0.0
+					? Base::add_up(s, Base::sqrt_up(upper(x)))
+					: Base::add_down(s, Base::sqrt_down(lower(x)));
+				auto t = Base::twosum(s, Base::div_down(r, d));
+
+				return {::std::get<0>(t), ::std::get<1>(t)};
+			}
+		};
+	}
+
+	template <>
+	struct trait<dd> : detail::rdd_trait<trait<double>>{
+		static void print_up(const dd &x, ::std::ostream &os)
+		{
+			::kv::rop<::kv::dd>::print_up(::kv::dd(x.hi, x.lo), os);
+		}
+
+		static void print_down(const dd &x, ::std::ostream &os)
+		{
+			::kv::rop<::kv::dd>::print_down(::kv::dd(x.hi, x.lo), os);
+		}
+
+		static constexpr auto whole()
+		{
+			constexpr auto infinity = ::std::numeric_limits<double>::infinity();
+			constexpr auto inf = detail::double_to_bits(-infinity);
+			constexpr auto sup = detail::double_to_bits(infinity);
+			return interval<dd_<inf, 0>, dd_<sup, 0>>{};
+		}
+	};
+
+	// x with double-double bounds, exactly
+	template <typename Inf, typename Sup>
+	constexpr auto to_dd(interval<Inf, Sup>)
+	{
+		using bound = detail::bound<dd>;
+
+		constexpr dd inf = Inf::value;
+		constexpr dd sup = Sup::value;
+
+		return detail::bound_interval_t<dd,
+			bound::leading(inf), bound::trailing(inf),
+			bound::leading(sup), bound::trailing(sup)>{};
+	}
+
+	// the tightest interval with double bounds containing x
+	template <typename Inf, typename Sup>
+	constexpr auto to_double(interval<Inf, Sup>)
+	{
+		constexpr auto inf = detail::double_to_bits(trait<dd>::lower(Inf::value));
+		constexpr auto sup = detail::double_to_bits(trait<dd>::upper(Sup::value));
+
+		return interval<double_<inf>, double_<sup>>{};
+	}
+
+	namespace detail{
+		// the rounded-down and rounded-up double-doubles of the unsigned
+		// decimal literal s[0, N), like decimal_bounds but divided to 106
+		// significant bits in two steps of 53.  values outside
+		// [2^-969, 2^1023), where lo would be subnormal or hi + lo could
+		// overflow, get the double bounds.
+		template <::std::size_t N>
+		constexpr ::std::pair<dd, dd> decimal_bounds_dd(const char *s)
+		{
+			constexpr ::std::size_t L = decimal_limbs(N);
+
+			auto x = decimal_parse<N>(s);
+
+			int e = 0;
+			decimal_bigint<L> a, b;
+			if(x.digits != 0 && !decimal_overflow(x) && !decimal_underflow(x))
+				e = decimal_fraction(x, a, b);
+
+			if(x.digits == 0 || decimal_overflow(x) || decimal_underflow(x) || e < -969 || e >= 1023)
+				return decimal_bounds<N>(s);
+
+			// floor(A / (B 2^u)) = q1 2^53 + q0 < 2^106
+			int u = e - 105;
+			decimal_bigint<L> r = u < 0 ? a.shl(-u) : a;
+			decimal_bigint<L> d = u > 0 ? b.shl(u) : b;
+			::std::uint64_t q1 = decimal_divide(r, d.shl(53));
+			::std::uint64_t q0 = decimal_divide(r, d);
+
+			double leading = static_cast<double>(q1) * double_pow2(u + 53);
+			auto lower = trait<double>::twosum(leading, static_cast<double>(q0) * double_pow2(u));
+			auto upper = r.zero()
+				? lower
+				: trait<double>::twosum(leading, static_cast<double>(q0 + 1) * double_pow2(u));
+
+			return {
+				dd{::std::get<0>(lower), ::std::get<1>(lower)},
+				dd{::std::get<0>(upper), ::std::get<1>(upper)}};
+		}
+
+		template <char ... Chars>
+		constexpr ::std::pair<dd, dd> literal_bounds_dd(::std::false_type)
+		{
+			constexpr char str[] = {Chars...};
+			return decimal_bounds_dd<sizeof...(Chars)>(str);
+		}
+
+		// hexadecimal literals get the double bounds of bcl
+		template <char ... Chars>
+		constexpr ::std::pair<dd, dd> literal_bounds_dd(::std::true_type)
+		{
+			return literal_bounds<Chars...>(::std::true_type{});
+		}
+	}
+
+	namespace literals{
+		inline namespace double_double_interval{
+			// the tightest interval with double-double bounds containing the
+			// decimal literal, e.g. 3.14159265358979323846264338327950288_ddi
+			template <char ... Chars>
+			constexpr auto operator "" _ddi()
+			{
+				using bound = ::cti::detail::bound<::cti::dd>;
+
+				constexpr auto bounds = ::cti::detail::literal_bounds_dd<Chars...>(
+					::std::integral_constant<bool, ::cti::detail::literal_hex<Chars...>()>{});
+				constexpr auto inf = ::std::get<0>(bounds);
+				constexpr auto sup = ::std::get<1>(bounds);
+
+				return ::cti::detail::bound_interval_t<::cti::dd,
+					bound::leading(inf), bound::trailing(inf),
+					bound::leading(sup), bound::trailing(sup)>{};
+			}
+		}
+	}
+}
+
+#define CTI_DD(x) ::cti::dd_<::cti::detail::double_to_bits((x).hi), ::cti::detail::double_to_bits((x).lo)>
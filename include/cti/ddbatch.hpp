@@ -0,0 +1,591 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <tuple>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/batch.hpp>
+#include <cti/dd.hpp>
+
+namespace cti{
+	// runtime batch of N intervals with double-double bounds, stored as four
+	// separate arrays: the leading and trailing parts of the lower and of
+	// the upper bounds.  the scalar counterpart is rinterval<dd>.
+	//
+	// the kernels are vectorized versions of trait<dd> on top of the lanes
+	// of detail::batch_trait, so the results are bit-identical to
+	// trait<dd> and detail::interval_operator_*_impl1<dd>.  the lanes for
+	// which trait<dd> falls back to double arithmetic (overflow,
+	// infinities, results below 2^-969) are recomputed with the scalar
+	// code.  compile with -ffp-contract=off as for cti/batch.hpp.
+	template <::std::size_t N>
+	struct ddbatch_interval{
+		static_assert(N > 0, "cti::ddbatch_interval must contain at least one interval");
+
+		using value_type = dd;
+
+		alignas(64) double inf_hi[N];
+		alignas(64) double inf_lo[N];
+		alignas(64) double sup_hi[N];
+		alignas(64) double sup_lo[N];
+
+		static constexpr ::std::size_t size()
+		{
+			return N;
+		}
+	};
+
+	namespace detail{
+		// the four arrays of a batch of dd intervals; D is double or const
+		// double
+		template <typename D>
+		struct ddbatch_arrays{
+			D *inf_hi;
+			D *inf_lo;
+			D *sup_hi;
+			D *sup_lo;
+
+			dd inf(::std::size_t i) const
+			{
+				return {inf_hi[i], inf_lo[i]};
+			}
+
+			dd sup(::std::size_t i) const
+			{
+				return {sup_hi[i], sup_lo[i]};
+			}
+
+			void set(::std::size_t i, const ::std::pair<dd, dd> &x) const
+			{
+				inf_hi[i] = ::std::get<0>(x).hi;
+				inf_lo[i] = ::std::get<0>(x).lo;
+				sup_hi[i] = ::std::get<1>(x).hi;
+				sup_lo[i] = ::std::get<1>(x).lo;
+			}
+		};
+
+		template <::std::size_t N>
+		ddbatch_arrays<const double> ddbatch_view(const ddbatch_interval<N> &x)
+		{
+			return {x.inf_hi, x.inf_lo, x.sup_hi, x.sup_lo};
+		}
+
+		template <::std::size_t N>
+		ddbatch_arrays<double> ddbatch_view(ddbatch_interval<N> &x)
+		{
+			return {x.inf_hi, x.inf_lo, x.sup_hi, x.sup_lo};
+		}
+
+#if defined(CTI_BATCH_SIMD)
+		// lane-wise counterpart of trait<dd>.  the fast path of every
+		// operation is evaluated on all lanes, and the lanes that trait<dd>
+		// sends to its fallback are patched with the scalar code.
+		template <typename V>
+		struct ddbatch_trait{
+			using vec = typename V::vec;
+			using mask = typename V::mask;
+			using bt = batch_trait<V>;
+
+			struct vdd{
+				vec hi;
+				vec lo;
+			};
+
+			static vdd load(const double *hi, const double *lo)
+			{
+				return {V::load(hi), V::load(lo)};
+			}
+
+			static void store(double *hi, double *lo, vdd x)
+			{
+				V::store(hi, x.hi);
+				V::store(lo, x.lo);
+			}
+
+			static vdd neg(vdd x)
+			{
+				return {V::neg(x.hi), V::neg(x.lo)};
+			}
+
+			// m ? x : y
+			static vdd select(mask m, vdd x, vdd y)
+			{
+				return {V::select(m, x.hi, y.hi), V::select(m, x.lo, y.lo)};
+			}
+
+			// x < y for normalized x and y
+			static mask lt(vdd x, vdd y)
+			{
+				return V::or_(V::lt(x.hi, y.hi), V::and_(V::eq(x.hi, y.hi), V::lt(x.lo, y.lo)));
+			}
+
+			static mask nonfinite(vec x)
+			{
+				return V::or_(V::eq(V::abs(x), V::set1(::std::numeric_limits<double>::infinity())), V::ne(x, x));
+			}
+
+			static vdd twosum(vec a, vec b)
+			{
+				vdd r;
+				bt::twosum(a, b, r.hi, r.lo);
+				return r;
+			}
+
+			static vec lower(vdd x)
+			{
+				return V::select(V::lt(x.lo, V::set1(0.0)), bt::pred(x.hi), x.hi);
+			}
+
+			static vec upper(vdd x)
+			{
+				return V::select(V::gt(x.lo, V::set1(0.0)), bt::succ(x.hi), x.hi);
+			}
+
+			// the lanes of m of f(x, y)
+			template <typename F>
+			static vdd patch(mask m, vdd r, vdd x, vdd y, F f)
+			{
+				unsigned bits = V::bits(m);
+				if(bits == 0)
+					return r;
+
+				alignas(64) double xh[V::width], xl[V::width], yh[V::width], yl[V::width], rh[V::width], rl[V::width];
+				store(xh, xl, x);
+				store(yh, yl, y);
+				store(rh, rl, r);
+
+				for(::std::size_t j = 0; bits != 0; ++j, bits >>= 1){
+					if(bits & 1u){
+						dd z = f(dd{xh[j], xl[j]}, dd{yh[j], yl[j]});
+						rh[j] = z.hi;
+						rl[j] = z.lo;
+					}
+				}
+
+				return load(rh, rl);
+			}
+
+			static vdd add_up(vdd x, vdd y)
+			{
+				vdd s = twosum(x.hi, y.hi);
+				vdd t = twosum(x.lo, y.lo);
+				vdd u = twosum(s.lo, t.hi);
+				vdd v = twosum(s.hi, u.hi);
+
+				vec e = bt::add_up(bt::add_up(u.lo, t.lo), v.lo);
+				vdd r = twosum(v.hi, e);
+
+				return patch(nonfinite(r.hi), r, x, y, [](const dd &a, const dd &b){
+					return trait<dd>::add_up(a, b);
+				});
+			}
+
+			static vdd add_down(vdd x, vdd y)
+			{
+				return neg(add_up(neg(x), neg(y)));
+			}
+
+			static vdd sub_up(vdd x, vdd y)
+			{
+				return add_up(x, neg(y));
+			}
+
+			static vdd sub_down(vdd x, vdd y)
+			{
+				return neg(add_up(neg(x), y));
+			}
+
+			static vdd mul_up(vdd x, vdd y)
+			{
+				constexpr double th = ::sprout::ldexp(1.0, -969);
+
+				vdd p;
+				bt::twoproduct(x.hi, y.hi, p.hi, p.lo);
+
+				vec c = bt::add_up(
+					bt::add_up(bt::mul_up(x.hi, y.lo), bt::mul_up(x.lo, y.hi)),
+					bt::mul_up(x.lo, y.lo));
+				vdd r = twosum(p.hi, bt::add_up(p.lo, c));
+
+				mask fallback = V::or_(
+					V::or_(nonfinite(p.hi), V::lt(V::abs(p.hi), V::set1(th))),
+					nonfinite(r.hi));
+
+				return patch(fallback, r, x, y, [](const dd &a, const dd &b){
+					return trait<dd>::mul_up(a, b);
+				});
+			}
+
+			static vdd mul_down(vdd x, vdd y)
+			{
+				return neg(mul_up(neg(x), y));
+			}
+
+			static vdd div_up(vdd x, vdd y)
+			{
+				constexpr double th = ::sprout::ldexp(1.0, -969);
+
+				mask negative = V::lt(y.hi, V::set1(0.0));
+				vdd xn = select(negative, neg(x), x);
+				vdd yn = select(negative, neg(y), y);
+
+				vec q = V::div(xn.hi, yn.hi);
+
+				vdd p;
+				bt::twoproduct(q, yn.hi, p.hi, p.lo);
+
+				vec r = bt::sub_up(xn.hi, p.hi);
+				r = bt::sub_up(r, p.lo);
+				r = bt::add_up(r, xn.lo);
+				r = bt::sub_up(r, bt::mul_down(q, yn.lo));
+
+				vec d = V::select(V::ge(r, V::set1(0.0)), lower(yn), upper(yn));
+				vdd s = twosum(q, bt::div_up(r, d));
+
+				mask fallback = V::or_(
+					V::or_(nonfinite(q), nonfinite(s.hi)),
+					V::or_(V::lt(V::abs(xn.hi), V::set1(th)), V::lt(yn.hi, V::set1(th))));
+
+				return patch(fallback, s, x, y, [](const dd &a, const dd &b){
+					return trait<dd>::div_up(a, b);
+				});
+			}
+
+			static vdd div_down(vdd x, vdd y)
+			{
+				return neg(div_up(neg(x), y));
+			}
+
+			// bt::sqrt_up on the lanes of up and bt::sqrt_down on the others,
+			// with a single square root
+			static vec sqrt_directed(vec x, mask up)
+			{
+				constexpr double th1 = ::sprout::ldexp(1.0, -969);
+				constexpr double c1 = ::sprout::ldexp(1.0, 106);
+				constexpr double c2 = ::sprout::ldexp(1.0, 53);
+
+				vec d = V::sqrt(x);
+
+				mask tiny = V::lt(x, V::set1(th1));
+				vec xs = V::select(tiny, V::mul(x, V::set1(c1)), x);
+				vec ds = V::select(tiny, V::mul(d, V::set1(c2)), d);
+
+				vec r, r2;
+				bt::twoproduct(ds, ds, r, r2);
+
+				mask below = V::or_(V::lt(r, xs), V::and_(V::eq(r, xs), V::lt(r2, V::set1(0.0))));
+				mask above = V::or_(V::gt(r, xs), V::and_(V::eq(r, xs), V::gt(r2, V::set1(0.0))));
+
+				vec result = V::select(V::and_(up, below), bt::succ(d), d);
+				return V::select(V::andnot(up, above), bt::pred(d), result);
+			}
+
+			static vdd sqrt_up(vdd x)
+			{
+				constexpr double th = ::sprout::ldexp(1.0, -969);
+
+				vec s = bt::sqrt_up(x.hi);
+
+				vdd p;
+				bt::twoproduct(s, s, p.hi, p.lo);
+
+				vec r = bt::sub_up(x.hi, p.hi);
+				r = bt::sub_up(r, p.lo);
+				r = bt::add_up(r, x.lo);
+
+				// s + sqrt_down(lower(x)) for r >= 0, s + sqrt_up(upper(x))
+				// otherwise
+				mask positive = V::ge(r, V::set1(0.0));
+				vec root = sqrt_directed(V::select(positive, lower(x), upper(x)), V::andnot(positive, V::eq(V::set1(0.0), V::set1(0.0))));
+				vec d = V::select(positive, bt::add_down(s, root), bt::add_up(s, root));
+				vdd t = twosum(s, bt::div_up(r, d));
+
+				mask fallback = V::or_(nonfinite(x.hi), V::lt(x.hi, V::set1(th)));
+
+				return patch(fallback, t, x, x, [](const dd &a, const dd &){
+					return trait<dd>::sqrt_up(a);
+				});
+			}
+
+			static vdd sqrt_down(vdd x)
+			{
+				constexpr double th = ::sprout::ldexp(1.0, -969);
+
+				vec s = bt::sqrt_up(x.hi);
+
+				vdd p;
+				bt::twoproduct(s, s, p.hi, p.lo);
+
+				vec r = bt::sub_down(x.hi, p.hi);
+				r = bt::sub_down(r, p.lo);
+				r = bt::add_down(r, x.lo);
+
+				// s + sqrt_up(upper(x)) for r >= 0, s + sqrt_down(lower(x))
+				// otherwise
+				mask positive = V::ge(r, V::set1(0.0));
+				vec root = sqrt_directed(V::select(positive, upper(x), lower(x)), positive);
+				vec d = V::select(positive, bt::add_up(s, root), bt::add_down(s, root));
+				vdd t = twosum(s, bt::div_down(r, d));
+
+				mask fallback = V::or_(nonfinite(x.hi), V::lt(x.hi, V::set1(th)));
+
+				return patch(fallback, t, x, x, [](const dd &a, const dd &){
+					return trait<dd>::sqrt_down(a);
+				});
+			}
+		};
+
+		// kernels over arrays of n dd intervals, with the same division of
+		// work as batch_kernel: the lanes that the scalar code treats
+		// specially are recomputed with interval_operator_*_impl1<dd>.
+		template <typename V>
+		struct ddbatch_kernel{
+			using vec = typename V::vec;
+			using mask = typename V::mask;
+			using dt = ddbatch_trait<V>;
+			using vdd = typename dt::vdd;
+
+			static constexpr ::std::size_t width = V::width;
+
+			static ::std::size_t add(::std::size_t n, ddbatch_arrays<const double> x, ddbatch_arrays<const double> y, ddbatch_arrays<double> z)
+			{
+				::std::size_t i = 0;
+
+				for(; i + width <= n; i += width){
+					vdd lower = dt::add_down(dt::load(x.inf_hi + i, x.inf_lo + i), dt::load(y.inf_hi + i, y.inf_lo + i));
+					vdd upper = dt::add_up(dt::load(x.sup_hi + i, x.sup_lo + i), dt::load(y.sup_hi + i, y.sup_lo + i));
+					dt::store(z.inf_hi + i, z.inf_lo + i, lower);
+					dt::store(z.sup_hi + i, z.sup_lo + i, upper);
+				}
+
+				return i;
+			}
+
+			static ::std::size_t sub(::std::size_t n, ddbatch_arrays<const double> x, ddbatch_arrays<const double> y, ddbatch_arrays<double> z)
+			{
+				::std::size_t i = 0;
+
+				for(; i + width <= n; i += width){
+					vdd lower = dt::sub_down(dt::load(x.inf_hi + i, x.inf_lo + i), dt::load(y.sup_hi + i, y.sup_lo + i));
+					vdd upper = dt::sub_up(dt::load(x.sup_hi + i, x.sup_lo + i), dt::load(y.inf_hi + i, y.inf_lo + i));
+					dt::store(z.inf_hi + i, z.inf_lo + i, lower);
+					dt::store(z.sup_hi + i, z.sup_lo + i, upper);
+				}
+
+				return i;
+			}
+
+			// the sign classes of batch_kernel::mul(mul_by_cases, ...); the
+			// sign of a dd is the sign of its leading part
+			static ::std::size_t mul(::std::size_t n, ddbatch_arrays<const double> x, ddbatch_arrays<const double> y, ddbatch_arrays<double> z)
+			{
+				constexpr double zero = 0.0;
+
+				const mask ones = V::eq(V::set1(zero), V::set1(zero));
+
+				::std::size_t i = 0;
+
+				for(; i + width <= n; i += width){
+					vdd i1 = dt::load(x.inf_hi + i, x.inf_lo + i), s1 = dt::load(x.sup_hi + i, x.sup_lo + i);
+					vdd i2 = dt::load(y.inf_hi + i, y.inf_lo + i), s2 = dt::load(y.sup_hi + i, y.sup_lo + i);
+
+					mask p1 = V::ge(i1.hi, V::set1(zero));
+					mask n1 = V::andnot(p1, V::le(s1.hi, V::set1(zero)));
+					mask m1 = V::andnot(V::or_(p1, n1), ones);
+					mask p2 = V::ge(i2.hi, V::set1(zero));
+					mask n2 = V::andnot(p2, V::le(s2.hi, V::set1(zero)));
+					mask m2 = V::andnot(V::or_(p2, n2), ones);
+
+					mask special = V::or_(V::and_(p1, V::eq(s1.hi, V::set1(zero))), V::and_(p2, V::eq(s2.hi, V::set1(zero))));
+
+					mask lower_a = V::or_(V::and_(p1, V::or_(n2, m2)), V::and_(n2, V::or_(n1, m1)));
+					mask lower_b = V::or_(n1, V::and_(m1, V::or_(p2, m2)));
+					mask upper_a = V::or_(n2, V::andnot(p1, m2));
+					mask upper_b = V::or_(n1, V::and_(m1, V::or_(n2, m2)));
+
+					vdd lower = dt::mul_down(dt::select(lower_a, s1, i1), dt::select(lower_b, s2, i2));
+					vdd upper = dt::mul_up(dt::select(upper_a, i1, s1), dt::select(upper_b, i2, s2));
+
+					mask mm = V::and_(m1, m2);
+					if(V::bits(mm) != 0){
+						vdd lower2 = dt::mul_down(s1, i2);
+						vdd upper2 = dt::mul_up(s1, s2);
+						lower = dt::select(V::and_(mm, dt::lt(lower2, lower)), lower2, lower);
+						upper = dt::select(V::and_(mm, dt::lt(upper, upper2)), upper2, upper);
+					}
+
+					dt::store(z.inf_hi + i, z.inf_lo + i, lower);
+					dt::store(z.sup_hi + i, z.sup_lo + i, upper);
+
+					unsigned bits = V::bits(special);
+					for(::std::size_t j = 0; bits != 0; ++j, bits >>= 1){
+						if(bits & 1u)
+							z.set(i + j, interval_operator_mul_impl1<dd>(x.inf(i + j), x.sup(i + j), y.inf(i + j), y.sup(i + j)));
+					}
+				}
+
+				return i;
+			}
+
+			static ::std::size_t div(::std::size_t n, ddbatch_arrays<const double> x, ddbatch_arrays<const double> y, ddbatch_arrays<double> z)
+			{
+				constexpr double zero = 0.0;
+
+				const mask ones = V::eq(V::set1(zero), V::set1(zero));
+
+				::std::size_t i = 0;
+
+				for(; i + width <= n; i += width){
+					vdd i1 = dt::load(x.inf_hi + i, x.inf_lo + i), s1 = dt::load(x.sup_hi + i, x.sup_lo + i);
+					vdd i2 = dt::load(y.inf_hi + i, y.inf_lo + i), s2 = dt::load(y.sup_hi + i, y.sup_lo + i);
+
+					mask p1 = V::ge(i1.hi, V::set1(zero));
+					mask n1 = V::andnot(p1, V::le(s1.hi, V::set1(zero)));
+					mask positive = V::gt(i2.hi, V::set1(zero));
+					mask negative = V::andnot(positive, V::lt(s2.hi, V::set1(zero)));
+
+					vdd lower_a = dt::select(positive, i1, s1);
+					vdd upper_a = dt::select(positive, s1, i1);
+					vdd lower_b = dt::select(V::or_(V::and_(positive, p1), V::andnot(V::or_(positive, n1), ones)), s2, i2);
+					vdd upper_b = dt::select(V::or_(n1, V::andnot(V::or_(positive, p1), negative)), s2, i2);
+
+					dt::store(z.inf_hi + i, z.inf_lo + i, dt::div_down(lower_a, lower_b));
+					dt::store(z.sup_hi + i, z.sup_lo + i, dt::div_up(upper_a, upper_b));
+
+					unsigned bits = ~V::bits(V::or_(positive, negative)) & ((1u << width) - 1);
+					for(::std::size_t j = 0; bits != 0; ++j, bits >>= 1){
+						if(bits & 1u)
+							z.set(i + j, interval_operator_div_impl1<dd>(x.inf(i + j), x.sup(i + j), y.inf(i + j), y.sup(i + j)));
+					}
+				}
+
+				return i;
+			}
+
+			static ::std::size_t sqrt(::std::size_t n, ddbatch_arrays<const double> x, ddbatch_arrays<double> z)
+			{
+				constexpr double zero = 0.0;
+				constexpr double infinity = ::std::numeric_limits<double>::infinity();
+
+				::std::size_t i = 0;
+
+				for(; i + width <= n; i += width){
+					vdd i1 = dt::load(x.inf_hi + i, x.inf_lo + i), s1 = dt::load(x.sup_hi + i, x.sup_lo + i);
+
+					if(V::bits(V::ge(i1.hi, V::set1(zero))) != (1u << width) - 1)
+						throw ::std::domain_error("cti::ddbatch_interval: sqrt of negative value");
+
+					// infinite bounds are kept as they are, as in
+					// interval_sqrt_impl
+					mask infinite1 = V::and_(V::eq(i1.hi, V::set1(infinity)), V::eq(i1.lo, V::set1(zero)));
+					mask infinite2 = V::and_(V::eq(s1.hi, V::set1(infinity)), V::eq(s1.lo, V::set1(zero)));
+
+					dt::store(z.inf_hi + i, z.inf_lo + i, dt::select(infinite1, i1, dt::sqrt_down(i1)));
+					dt::store(z.sup_hi + i, z.sup_lo + i, dt::select(infinite2, s1, dt::sqrt_up(s1)));
+				}
+
+				return i;
+			}
+		};
+#endif
+
+		inline void ddbatch_add(::std::size_t n, ddbatch_arrays<const double> x, ddbatch_arrays<const double> y, ddbatch_arrays<double> z)
+		{
+			::std::size_t i = 0;
+#if defined(CTI_BATCH_SIMD)
+			i = ddbatch_kernel<simd::native>::add(n, x, y, z);
+#endif
+			for(; i < n; ++i)
+				z.set(i, interval_operator_add_impl1<dd>(x.inf(i), x.sup(i), y.inf(i), y.sup(i)));
+		}
+
+		inline void ddbatch_sub(::std::size_t n, ddbatch_arrays<const double> x, ddbatch_arrays<const double> y, ddbatch_arrays<double> z)
+		{
+			::std::size_t i = 0;
+#if defined(CTI_BATCH_SIMD)
+			i = ddbatch_kernel<simd::native>::sub(n, x, y, z);
+#endif
+			for(; i < n; ++i)
+				z.set(i, interval_operator_sub_impl1<dd>(x.inf(i), x.sup(i), y.inf(i), y.sup(i)));
+		}
+
+		inline void ddbatch_mul(::std::size_t n, ddbatch_arrays<const double> x, ddbatch_arrays<const double> y, ddbatch_arrays<double> z)
+		{
+			::std::size_t i = 0;
+#if defined(CTI_BATCH_SIMD)
+			i = ddbatch_kernel<simd::native>::mul(n, x, y, z);
+#endif
+			for(; i < n; ++i)
+				z.set(i, interval_operator_mul_impl1<dd>(x.inf(i), x.sup(i), y.inf(i), y.sup(i)));
+		}
+
+		inline void ddbatch_div(::std::size_t n, ddbatch_arrays<const double> x, ddbatch_arrays<const double> y, ddbatch_arrays<double> z)
+		{
+			::std::size_t i = 0;
+#if defined(CTI_BATCH_SIMD)
+			i = ddbatch_kernel<simd::native>::div(n, x, y, z);
+#endif
+			for(; i < n; ++i)
+				z.set(i, interval_operator_div_impl1<dd>(x.inf(i), x.sup(i), y.inf(i), y.sup(i)));
+		}
+
+		inline void ddbatch_sqrt(::std::size_t n, ddbatch_arrays<const double> x, ddbatch_arrays<double> z)
+		{
+			::std::size_t i = 0;
+#if defined(CTI_BATCH_SIMD)
+			i = ddbatch_kernel<simd::native>::sqrt(n, x, z);
+#endif
+			for(; i < n; ++i){
+				if(!(x.inf_hi[i] >= 0.0))
+					throw ::std::domain_error("cti::ddbatch_interval: sqrt of negative value");
+
+				z.set(i, interval_sqrt_impl<dd>(x.inf(i), x.sup(i)));
+			}
+		}
+	}
+
+	template <::std::size_t N>
+	ddbatch_interval<N> operator+(const ddbatch_interval<N> &x, const ddbatch_interval<N> &y)
+	{
+		ddbatch_interval<N> z;
+		detail::ddbatch_add(N, detail::ddbatch_view(x), detail::ddbatch_view(y), detail::ddbatch_view(z));
+		return z;
+	}
+
+	template <::std::size_t N>
+	ddbatch_interval<N> operator-(const ddbatch_interval<N> &x, const ddbatch_interval<N> &y)
+	{
+		ddbatch_interval<N> z;
+		detail::ddbatch_sub(N, detail::ddbatch_view(x), detail::ddbatch_view(y), detail::ddbatch_view(z));
+		return z;
+	}
+
+	template <::std::size_t N>
+	ddbatch_interval<N> operator*(const ddbatch_interval<N> &x, const ddbatch_interval<N> &y)
+	{
+		ddbatch_interval<N> z;
+		detail::ddbatch_mul(N, detail::ddbatch_view(x), detail::ddbatch_view(y), detail::ddbatch_view(z));
+		return z;
+	}
+
+	template <::std::size_t N>
+	ddbatch_interval<N> operator/(const ddbatch_interval<N> &x, const ddbatch_interval<N> &y)
+	{
+		ddbatch_interval<N> z;
+		detail::ddbatch_div(N, detail::ddbatch_view(x), detail::ddbatch_view(y), detail::ddbatch_view(z));
+		return z;
+	}
+
+	template <::std::size_t N>
+	ddbatch_interval<N> sqrt(const ddbatch_interval<N> &x)
+	{
+		ddbatch_interval<N> z;
+		detail::ddbatch_sqrt(N, detail::ddbatch_view(x), detail::ddbatch_view(z));
+		return z;
+	}
+}
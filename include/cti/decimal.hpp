@@ -0,0 +1,366 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <cti/double.hpp>
+
+namespace cti{
+	namespace detail{
+		// unsigned integer of at most L 32-bit limbs, least significant first,
+		// with just the operations needed by decimal_bounds.  only the n
+		// limbs in use are visited, and limb[n - 1] is never 0.  the capacity
+		// is chosen by the caller; carries beyond L limbs are dropped.
+		template <::std::size_t L>
+		struct decimal_bigint{
+			::std::uint32_t limb[L] = {};
+			::std::size_t n = 0;
+
+			constexpr void trim()
+			{
+				while(n > 0 && limb[n - 1] == 0)
+					--n;
+			}
+
+			constexpr bool zero() const
+			{
+				return n == 0;
+			}
+
+			// *this = *this * m + a
+			constexpr void mul_add(::std::uint32_t m, ::std::uint32_t a)
+			{
+				::std::uint64_t carry = a;
+				for(::std::size_t i = 0; i < n; ++i){
+					::std::uint64_t t = static_cast<::std::uint64_t>(limb[i]) * m + carry;
+					limb[i] = static_cast<::std::uint32_t>(t);
+					carry = t >> 32;
+				}
+				if(carry != 0 && n < L)
+					limb[n++] = static_cast<::std::uint32_t>(carry);
+				trim();
+			}
+
+			constexpr void add(const decimal_bigint &x)
+			{
+				::std::size_t m = n > x.n ? n : x.n;
+				::std::uint64_t carry = 0;
+				for(::std::size_t i = 0; i < m; ++i){
+					::std::uint64_t t = carry + (i < n ? limb[i] : 0) + (i < x.n ? x.limb[i] : 0);
+					limb[i] = static_cast<::std::uint32_t>(t);
+					carry = t >> 32;
+				}
+				n = m;
+				if(carry != 0 && n < L)
+					limb[n++] = static_cast<::std::uint32_t>(carry);
+			}
+
+			constexpr decimal_bigint mul(::std::uint64_t m) const
+			{
+				decimal_bigint hi = *this, lo = *this;
+				hi.mul_add(static_cast<::std::uint32_t>(m >> 32), 0);
+				lo.mul_add(static_cast<::std::uint32_t>(m), 0);
+				hi = hi.shl(32);
+				hi.add(lo);
+				return hi;
+			}
+
+			// number of significant bits
+			constexpr int bits() const
+			{
+				if(n == 0)
+					return 0;
+
+				int b = 0;
+				for(::std::uint32_t x = limb[n - 1]; x != 0; x >>= 1)
+					++b;
+				return static_cast<int>(n - 1) * 32 + b;
+			}
+
+			constexpr decimal_bigint shl(int s) const
+			{
+				decimal_bigint r;
+				if(n == 0)
+					return r;
+
+				::std::size_t q = static_cast<::std::size_t>(s / 32);
+				int b = s % 32;
+				r.n = n + q + 1 < L ? n + q + 1 : L;
+				for(::std::size_t i = r.n; i-- > q;){
+					::std::uint64_t x = i - q < n ? static_cast<::std::uint64_t>(limb[i - q]) << b : 0;
+					if(b != 0 && i > q && i - q - 1 < n)
+						x |= limb[i - q - 1] >> (32 - b);
+					r.limb[i] = static_cast<::std::uint32_t>(x);
+				}
+				r.trim();
+				return r;
+			}
+
+			constexpr void shr1()
+			{
+				for(::std::size_t i = 0; i < n; ++i)
+					limb[i] = limb[i] >> 1 | (i + 1 < n ? limb[i + 1] << 31 : 0);
+				trim();
+			}
+
+			constexpr int compare(const decimal_bigint &x) const
+			{
+				if(n != x.n)
+					return n < x.n ? -1 : 1;
+				for(::std::size_t i = n; i-- > 0;){
+					if(limb[i] != x.limb[i])
+						return limb[i] < x.limb[i] ? -1 : 1;
+				}
+				return 0;
+			}
+
+			// *this -= x, where *this >= x
+			constexpr void sub(const decimal_bigint &x)
+			{
+				::std::int64_t borrow = 0;
+				for(::std::size_t i = 0; i < n; ++i){
+					::std::int64_t t = static_cast<::std::int64_t>(limb[i]) - (i < x.n ? x.limb[i] : 0) - borrow;
+					borrow = t < 0 ? 1 : 0;
+					limb[i] = static_cast<::std::uint32_t>(t + (borrow << 32));
+				}
+				trim();
+			}
+
+#if defined(__SIZEOF_INT128__)
+			// floor(*this / 2^s), which must fit in 128 bits
+			constexpr unsigned __int128 shr128(int s) const
+			{
+				unsigned __int128 r = 0;
+				for(::std::size_t i = 0; i < n; ++i){
+					int p = static_cast<int>(i) * 32 - s;
+					if(p >= 0)
+						r |= static_cast<unsigned __int128>(limb[i]) << p;
+					else if(p > -32)
+						r |= limb[i] >> -p;
+				}
+				return r;
+			}
+#endif
+
+			// *this *= 10^k
+			constexpr void mul_pow10(int k)
+			{
+				for(; k >= 9; k -= 9)
+					mul_add(1000000000, 0);
+				::std::uint32_t m = 1;
+				for(; k > 0; --k)
+					m *= 10;
+				mul_add(m, 0);
+			}
+		};
+
+		// returns floor(r / d), which must be less than 2^54, and leaves the
+		// remainder in r
+		template <::std::size_t L>
+		constexpr ::std::uint64_t decimal_divide(decimal_bigint<L> &r, const decimal_bigint<L> &d)
+		{
+#if defined(__SIZEOF_INT128__)
+			// the quotient of the leading 64 bits of d into r is off by at
+			// most one
+			int s = d.bits() > 64 ? d.bits() - 64 : 0;
+			auto q = static_cast<::std::uint64_t>(r.shr128(s) / d.shr128(s));
+
+			decimal_bigint<L> p = d.mul(q);
+			for(; p.compare(r) > 0; --q)
+				p.sub(d);
+			r.sub(p);
+			for(; r.compare(d) >= 0; ++q)
+				r.sub(d);
+
+			return q;
+#else
+			// binary long division
+			decimal_bigint<L> t = d.shl(53);
+			::std::uint64_t q = 0;
+			for(int bit = 53; bit >= 0; --bit){
+				if(r.compare(t) >= 0){
+					r.sub(t);
+					q |= ::std::uint64_t(1) << bit;
+				}
+				t.shr1();
+			}
+			return q;
+#endif
+		}
+
+		constexpr bool decimal_digit(char c)
+		{
+			return '0' <= c && c <= '9';
+		}
+
+		// a decimal literal D 10^E, with the integer D of at most L limbs
+		template <::std::size_t L>
+		struct decimal_literal{
+			decimal_bigint<L> d;
+			int digits = 0;
+			int exponent = 0;
+		};
+
+		// the number of limbs for a literal of N characters: values beyond
+		// the range of double are decided from the number of digits alone,
+		// which bounds the integers by about 3.4 N + 1200 bits, plus the
+		// 106 bits of a double-double quotient
+		constexpr ::std::size_t decimal_limbs(::std::size_t n)
+		{
+			return (n * 7 / 2 + 1300) / 32 + 6;
+		}
+
+		// reads the unsigned decimal literal s[0, N): digits with an optional
+		// '.', an optional exponent e[+-]digits and ' digit separators
+		template <::std::size_t N>
+		constexpr decimal_literal<decimal_limbs(N)> decimal_parse(const char *s)
+		{
+			constexpr int exponent_limit = 100000;
+
+			decimal_literal<decimal_limbs(N)> x;
+			bool point = false;
+
+			// digits are collected 9 at a time before they enter d
+			::std::uint32_t chunk = 0;
+			::std::uint32_t scale = 1;
+
+			::std::size_t i = 0;
+			for(; i < N; ++i){
+				char c = s[i];
+				if(c == '\'')
+					continue;
+				if(c == '.'){
+					if(point)
+						throw ::std::invalid_argument("cti::literals: invalid decimal literal");
+					point = true;
+					continue;
+				}
+				if(!decimal_digit(c))
+					break;
+
+				if(point)
+					--x.exponent;
+				if(x.digits == 0 && c == '0')
+					continue;
+
+				chunk = chunk * 10 + static_cast<::std::uint32_t>(c - '0');
+				scale *= 10;
+				++x.digits;
+				if(scale == 1000000000){
+					x.d.mul_add(scale, chunk);
+					chunk = 0;
+					scale = 1;
+				}
+			}
+			x.d.mul_add(scale, chunk);
+
+			if(i < N){
+				if(s[i] != 'e' && s[i] != 'E')
+					throw ::std::invalid_argument("cti::literals: invalid decimal literal");
+
+				bool negative = false;
+				if(++i < N && (s[i] == '+' || s[i] == '-'))
+					negative = s[i++] == '-';
+				if(i == N)
+					throw ::std::invalid_argument("cti::literals: invalid decimal literal");
+
+				int e = 0;
+				for(; i < N; ++i){
+					if(s[i] == '\'')
+						continue;
+					if(!decimal_digit(s[i]))
+						throw ::std::invalid_argument("cti::literals: invalid decimal literal");
+					if(e < exponent_limit)
+						e = e * 10 + (s[i] - '0');
+				}
+				x.exponent += negative ? -e : e;
+			}
+
+			return x;
+		}
+
+		// D 10^E >= 10^309
+		template <::std::size_t L>
+		constexpr bool decimal_overflow(const decimal_literal<L> &x)
+		{
+			return x.digits - 1 + x.exponent >= 309;
+		}
+
+		// 0 < D 10^E < 10^-324 < 2^-1074
+		template <::std::size_t L>
+		constexpr bool decimal_underflow(const decimal_literal<L> &x)
+		{
+			return x.digits + x.exponent <= -324;
+		}
+
+		// writes D 10^E = A / B and returns e with 2^e <= A / B < 2^(e + 1),
+		// for a nonzero literal that neither overflows nor underflows
+		template <::std::size_t L>
+		constexpr int decimal_fraction(const decimal_literal<L> &x, decimal_bigint<L> &a, decimal_bigint<L> &b)
+		{
+			a = x.d;
+			b = decimal_bigint<L>{};
+			b.limb[0] = 1;
+			b.n = 1;
+			if(x.exponent > 0)
+				a.mul_pow10(x.exponent);
+			else
+				b.mul_pow10(-x.exponent);
+
+			int e = a.bits() - b.bits();
+			bool at_least = e >= 0
+				? a.compare(b.shl(e)) >= 0
+				: a.shl(-e).compare(b) >= 0;
+
+			return at_least ? e : e - 1;
+		}
+
+		// the rounded-down and rounded-up doubles of the unsigned decimal
+		// literal s[0, N).  the literal is read once into an integer D and
+		// an exponent E, and the value D 10^E = A / B is divided exactly to
+		// 53 significant bits (or to 2^-1074 for subnormals) with a single
+		// big-integer division; a nonzero remainder makes the bounds
+		// adjacent.  arbitrary lengths and exponents are supported.
+		template <::std::size_t N>
+		constexpr ::std::pair<double, double> decimal_bounds(const char *s)
+		{
+			constexpr ::std::size_t L = decimal_limbs(N);
+			constexpr double infinity = ::std::numeric_limits<double>::infinity();
+
+			auto x = decimal_parse<N>(s);
+
+			if(x.digits == 0)
+				return {0.0, 0.0};
+			if(decimal_overflow(x))
+				return {::std::numeric_limits<double>::max(), infinity};
+			if(decimal_underflow(x))
+				return {0.0, ::std::numeric_limits<double>::denorm_min()};
+
+			decimal_bigint<L> a, b;
+			int e = decimal_fraction(x, a, b);
+
+			if(e >= 1024)
+				return {::std::numeric_limits<double>::max(), infinity};
+
+			// q = floor(A / (B 2^u)) < 2^53
+			int u = e - 52 > -1074 ? e - 52 : -1074;
+			decimal_bigint<L> r = u < 0 ? a.shl(-u) : a;
+			::std::uint64_t q = decimal_divide(r, u > 0 ? b.shl(u) : b);
+
+			double ulp = double_pow2(u);
+			double lower = static_cast<double>(q) * ulp;
+			double upper = lower;
+			if(!r.zero()){
+				// the successor of the largest double
+				upper = e == 1023 && q + 1 == ::std::uint64_t(1) << 53
+					? infinity
+					: static_cast<double>(q + 1) * ulp;
+			}
+
+			return {lower, upper};
+		}
+	}
+}
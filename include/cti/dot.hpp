@@ -0,0 +1,384 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/rinterval.hpp>
+#include <cti/batch.hpp>
+#include <cti/matrix.hpp>
+#include <cti/parallel.hpp>
+
+namespace cti{
+	namespace detail{
+		// compensated partial sum of K-fold accuracy (Ogita, Rump and Oishi).
+		// a new term passes through a cascade of K - 1 twosums and only the
+		// last rounding error is summed in q, so that at any time
+		//
+		//     exact value = s[0] + ... + s[K-2] + (sum of the terms in q)
+		//
+		// holds exactly.  q and a = sum |terms| are rounded to nearest and
+		// their error is covered by the a priori bound of enclose().  K = 2 is
+		// Dot2/Sum2.
+		template <unsigned K>
+		struct dot_partial{
+			static_assert(K >= 2, "cti::dot needs K >= 2");
+
+			double s[K - 1] = {};
+			double q = 0.0;
+			double a = 0.0;
+			double terms = 0.0;
+
+			// adds x to the cascade from the given level on
+			void add(double x, unsigned level = 0)
+			{
+				for(unsigned l = level; l < K - 1; ++l){
+					auto t = trait<double>::twosum(s[l], x);
+					s[l] = ::std::get<0>(t);
+					x = ::std::get<1>(t);
+				}
+
+				q += x;
+				a += ::std::fabs(x);
+				terms += 1.0;
+			}
+
+			// the rounding error of the product enters one level below it
+			void add_product(double x, double y)
+			{
+				add_product(trait<double>::twoproduct(x, y));
+			}
+
+			void add_product(const ::std::pair<double, double> &p)
+			{
+				add(::std::get<0>(p));
+				add(::std::get<1>(p), 1);
+			}
+
+			void merge(const dot_partial &x)
+			{
+				for(unsigned l = 0; l < K - 1; ++l)
+					add(x.s[l], l);
+
+				q += x.q;
+				a += x.a;
+				terms += x.terms;
+			}
+
+			// enclosure of the exact value.  the terms are summed in q by
+			// some binary tree of additions rounded to nearest, hence
+			//
+			//     |q - sum terms| <= gamma_N sum |terms| <= gamma_N a / (1 - gamma_N)
+			//
+			// with N = terms.  twoproduct is exact up to 5 eta per product
+			// when the product underflows.
+			::std::pair<double, double> enclose(double products) const
+			{
+				using tr = trait<double>;
+
+				constexpr double u = ::std::numeric_limits<double>::epsilon() / 2.0;
+				constexpr double eta = ::std::numeric_limits<double>::denorm_min();
+
+				double nu = tr::mul_up(terms, u);
+				double gamma = tr::div_up(nu, tr::sub_down(1.0, nu));
+				double bound = tr::div_up(tr::mul_up(gamma, a), tr::sub_down(1.0, gamma));
+				bound = tr::add_up(bound, tr::mul_up(products, 5.0 * eta));
+
+				// the levels decrease in magnitude, add them from the smallest
+				double lower = q, upper = q;
+				for(unsigned l = K - 1; l-- > 0;){
+					lower = tr::add_down(lower, s[l]);
+					upper = tr::add_up(upper, s[l]);
+				}
+
+				return {tr::sub_down(lower, bound), tr::add_up(upper, bound)};
+			}
+		};
+
+		template <unsigned K>
+		struct dot_interval_partial{
+			dot_partial<K> lower;
+			dot_partial<K> upper;
+
+			void merge(const dot_interval_partial &x)
+			{
+				lower.merge(x.lower);
+				upper.merge(x.upper);
+			}
+		};
+
+		// elements per block.  the blocks are accumulated independently and
+		// merged in order, so the result does not depend on the number of
+		// threads.
+		constexpr ::std::size_t dot_block = ::std::size_t(1) << 16;
+
+		// P block(begin, end) for every block of [0, n), merged in block order
+		template <typename P, typename F>
+		P dot_reduce(::std::size_t n, unsigned threads, F block)
+		{
+			::std::size_t blocks = (n + dot_block - 1) / dot_block;
+			::std::vector<P> partials(blocks);
+
+			parallel_for(blocks, threads, [&](::std::size_t b0, ::std::size_t b1){
+				for(::std::size_t b = b0; b < b1; ++b){
+					::std::size_t end = (b + 1) * dot_block < n ? (b + 1) * dot_block : n;
+					partials[b] = block(b * dot_block, end);
+				}
+			});
+
+			P result;
+			for(const auto &p : partials)
+				result.merge(p);
+
+			return result;
+		}
+
+		inline void dot_check(::std::size_t n, ::std::size_t m)
+		{
+			if(n != m)
+				throw ::std::invalid_argument("cti::dot: sizes do not match");
+		}
+
+#if defined(CTI_BATCH_SIMD)
+		// the cascade of dot_partial on every lane, with two independent
+		// accumulators to hide the latency of twosum.  returns the number of
+		// elements processed; the lanes are merged into p.
+		template <typename V, unsigned K>
+		struct dot_kernel{
+			using vec = typename V::vec;
+			using bt = batch_trait<V>;
+
+			static constexpr ::std::size_t width = V::width;
+			static constexpr ::std::size_t unroll = 2;
+
+			struct lanes{
+				vec s[K - 1];
+				vec q;
+				vec a;
+
+				lanes()
+				{
+					for(unsigned l = 0; l < K - 1; ++l)
+						s[l] = V::set1(0.0);
+					q = a = V::set1(0.0);
+				}
+
+				void add(vec x, unsigned level)
+				{
+					for(unsigned l = level; l < K - 1; ++l)
+						bt::twosum(s[l], x, s[l], x);
+
+					q = V::add(q, x);
+					a = V::add(a, V::abs(x));
+				}
+
+				void add_product(vec x, vec y)
+				{
+					vec h, r;
+					bt::twoproduct(x, y, h, r);
+					add(h, 0);
+					add(r, 1);
+				}
+
+				// terms added per lane so far
+				void merge_into(dot_partial<K> &p, double terms) const
+				{
+					alignas(64) double s_lanes[K - 1][width];
+					alignas(64) double q_lanes[width], a_lanes[width];
+
+					for(unsigned l = 0; l < K - 1; ++l)
+						V::store(s_lanes[l], s[l]);
+					V::store(q_lanes, q);
+					V::store(a_lanes, a);
+
+					for(::std::size_t j = 0; j < width; ++j){
+						dot_partial<K> lane;
+						for(unsigned l = 0; l < K - 1; ++l)
+							lane.s[l] = s_lanes[l][j];
+						lane.q = q_lanes[j];
+						lane.a = a_lanes[j];
+						lane.terms = terms;
+						p.merge(lane);
+					}
+				}
+			};
+
+			static ::std::size_t dot(::std::size_t n, const double *x, const double *y, dot_partial<K> &p)
+			{
+				lanes acc[unroll];
+				::std::size_t i = 0;
+
+				for(; i + unroll * width <= n; i += unroll * width){
+					for(::std::size_t u = 0; u < unroll; ++u)
+						acc[u].add_product(V::load(x + i + u * width), V::load(y + i + u * width));
+				}
+
+				double terms = 2.0 * static_cast<double>(i / (unroll * width));
+				for(::std::size_t u = 0; u < unroll; ++u)
+					acc[u].merge_into(p, terms);
+
+				return i;
+			}
+
+			static ::std::size_t sum(::std::size_t n, const double *x, dot_partial<K> &p)
+			{
+				lanes acc[unroll];
+				::std::size_t i = 0;
+
+				for(; i + unroll * width <= n; i += unroll * width){
+					for(::std::size_t u = 0; u < unroll; ++u)
+						acc[u].add(V::load(x + i + u * width), 0);
+				}
+
+				double terms = static_cast<double>(i / (unroll * width));
+				for(::std::size_t u = 0; u < unroll; ++u)
+					acc[u].merge_into(p, terms);
+
+				return i;
+			}
+		};
+#endif
+
+		template <unsigned K>
+		dot_partial<K> dot_block_impl(::std::size_t n, const double *x, const double *y)
+		{
+			dot_partial<K> p;
+			::std::size_t i = 0;
+#if defined(CTI_BATCH_SIMD)
+			i = dot_kernel<simd::native, K>::dot(n, x, y, p);
+#endif
+			for(; i < n; ++i)
+				p.add_product(x[i], y[i]);
+
+			return p;
+		}
+
+		template <unsigned K>
+		dot_partial<K> sum_block_impl(::std::size_t n, const double *x)
+		{
+			dot_partial<K> p;
+			::std::size_t i = 0;
+#if defined(CTI_BATCH_SIMD)
+			i = dot_kernel<simd::native, K>::sum(n, x, p);
+#endif
+			for(; i < n; ++i)
+				p.add(x[i]);
+
+			return p;
+		}
+
+		// exact comparison of two products given by twoproduct
+		inline bool dot_product_less(const ::std::pair<double, double> &x, const ::std::pair<double, double> &y)
+		{
+			return ::std::get<0>(x) < ::std::get<0>(y)
+				|| (::std::get<0>(x) == ::std::get<0>(y) && ::std::get<1>(x) < ::std::get<1>(y));
+		}
+
+		// the lower (upper) bound of an interval dot product is the sum of
+		// the smallest (largest) endpoint products, selected exactly
+		template <unsigned K>
+		dot_interval_partial<K> dot_interval_block_impl(::std::size_t begin, ::std::size_t end,
+			const double *inf1, const double *sup1, const double *inf2, const double *sup2)
+		{
+			using tr = trait<double>;
+
+			dot_interval_partial<K> p;
+
+			for(::std::size_t i = begin; i < end; ++i){
+				::std::pair<double, double> c[4] = {
+					tr::twoproduct(inf1[i], inf2[i]),
+					tr::twoproduct(inf1[i], sup2[i]),
+					tr::twoproduct(sup1[i], inf2[i]),
+					tr::twoproduct(sup1[i], sup2[i])
+				};
+
+				::std::size_t lo = 0, hi = 0;
+				for(::std::size_t j = 1; j < 4; ++j){
+					if(dot_product_less(c[j], c[lo]))
+						lo = j;
+					if(dot_product_less(c[hi], c[j]))
+						hi = j;
+				}
+
+				p.lower.add_product(c[lo]);
+				p.upper.add_product(c[hi]);
+			}
+
+			return p;
+		}
+	}
+
+	// verified dot product x^T y of n doubles.  the result is the exact
+	// value rounded outward as if it were computed in K-fold working
+	// precision, plus an a priori bound of the remaining error (Dot2 for
+	// K = 2, DotK otherwise).  the inputs must be finite and the products
+	// must not overflow.
+	//
+	// the work is split into blocks of detail::dot_block elements that are
+	// distributed over `threads` threads (0: all hardware threads); the
+	// compensated partials of the blocks are merged in a fixed order, so the
+	// result is the same for any number of threads.
+	template <unsigned K = 2>
+	rinterval<double> dot(const double *x, const double *y, ::std::size_t n, unsigned threads = 1)
+	{
+		auto p = detail::dot_reduce<detail::dot_partial<K>>(n, threads, [&](::std::size_t begin, ::std::size_t end){
+			return detail::dot_block_impl<K>(end - begin, x + begin, y + begin);
+		});
+
+		auto r = p.enclose(static_cast<double>(n));
+		return {::std::get<0>(r), ::std::get<1>(r)};
+	}
+
+	template <unsigned K = 2>
+	rinterval<double> dot(const ::std::vector<double> &x, const ::std::vector<double> &y, unsigned threads = 1)
+	{
+		detail::dot_check(x.size(), y.size());
+		return dot<K>(x.data(), y.data(), x.size(), threads);
+	}
+
+	// verified dot product of interval vectors.  the endpoint products are
+	// selected exactly, so the result is the exact interval dot product
+	// rounded outward as with the double version.
+	template <unsigned K = 2>
+	rinterval<double> dot(const ivector &x, const ivector &y, unsigned threads = 1)
+	{
+		detail::dot_check(x.size(), y.size());
+
+		auto p = detail::dot_reduce<detail::dot_interval_partial<K>>(x.size(), threads, [&](::std::size_t begin, ::std::size_t end){
+			return detail::dot_interval_block_impl<K>(begin, end, x.inf.data(), x.sup.data(), y.inf.data(), y.sup.data());
+		});
+
+		double n = static_cast<double>(x.size());
+		return {::std::get<0>(p.lower.enclose(n)), ::std::get<1>(p.upper.enclose(n))};
+	}
+
+	// verified sum of n doubles (Sum2 for K = 2, SumK otherwise)
+	template <unsigned K = 2>
+	rinterval<double> sum(const double *x, ::std::size_t n, unsigned threads = 1)
+	{
+		auto p = detail::dot_reduce<detail::dot_partial<K>>(n, threads, [&](::std::size_t begin, ::std::size_t end){
+			return detail::sum_block_impl<K>(end - begin, x + begin);
+		});
+
+		auto r = p.enclose(0.0);
+		return {::std::get<0>(r), ::std::get<1>(r)};
+	}
+
+	template <unsigned K = 2>
+	rinterval<double> sum(const ::std::vector<double> &x, unsigned threads = 1)
+	{
+		return sum<K>(x.data(), x.size(), threads);
+	}
+
+	// the sums of the lower and of the upper bounds
+	template <unsigned K = 2>
+	rinterval<double> sum(const ivector &x, unsigned threads = 1)
+	{
+		return {sum<K>(x.inf, threads).lower(), sum<K>(x.sup, threads).upper()};
+	}
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <bcl/double.hpp>
+
+namespace cti{
+	namespace detail{
+		// 2^e for -1074 <= e <= 1023, exact
+		constexpr double double_pow2(int e)
+		{
+			double r = 1.0;
+			double b = e < 0 ? 0.5 : 2.0;
+			unsigned n = static_cast<unsigned>(e < 0 ? -e : e);
+
+			while(n != 0){
+				if(n & 1)
+					r *= b;
+				n >>= 1;
+				// b must not overflow after the last step
+				if(n != 0)
+					b *= b;
+			}
+
+			return r;
+		}
+
+		// the IEEE 754 binary64 bit pattern of x
+		constexpr ::std::uint64_t double_to_bits(double x)
+		{
+			constexpr ::std::uint64_t sign_bit = ::std::uint64_t(1) << 63;
+
+			if(x != x)
+				return 0x7ff8000000000000u;
+
+			::std::uint64_t sign = __builtin_signbit(x) ? sign_bit : 0;
+			double a = x < 0 ? -x : x;
+
+			if(a == ::std::numeric_limits<double>::infinity())
+				return sign | 0x7ff0000000000000u;
+			if(a == 0.0)
+				return sign;
+
+			// subnormal: the fraction is a * 2^1074
+			if(a < ::std::numeric_limits<double>::min())
+				return sign | static_cast<::std::uint64_t>(a * double_pow2(537) * double_pow2(537));
+
+			// scale a into [1, 2) by powers of two, which is exact
+			int e = 0;
+			for(int step = 512; step > 0; step >>= 1){
+				if(a >= double_pow2(step)){
+					a *= double_pow2(-step);
+					e += step;
+				}
+				if(a < double_pow2(1 - step)){
+					a *= double_pow2(step);
+					e -= step;
+				}
+			}
+
+			auto fraction = static_cast<::std::uint64_t>((a - 1.0) * double_pow2(52));
+			return sign | static_cast<::std::uint64_t>(e + 1023) << 52 | fraction;
+		}
+
+		constexpr double bits_to_double(::std::uint64_t bits)
+		{
+			constexpr ::std::uint64_t fraction_mask = (::std::uint64_t(1) << 52) - 1;
+
+			bool sign = (bits >> 63) != 0;
+			int biased = static_cast<int>(bits >> 52 & 0x7ff);
+			::std::uint64_t fraction = bits & fraction_mask;
+
+			double a = 0.0;
+			if(biased == 0x7ff)
+				a = fraction != 0 ? ::std::numeric_limits<double>::quiet_NaN() : ::std::numeric_limits<double>::infinity();
+			else if(biased == 0)
+				a = static_cast<double>(fraction) * double_pow2(-1074);
+			else
+				a = static_cast<double>(fraction | (fraction_mask + 1)) * double_pow2(biased - 1075);
+
+			return sign ? -a : a;
+		}
+	}
+
+	// double encoded as a type by its bit pattern.  it is the bound type of
+	// the intervals produced by the operators: a single non-type template
+	// parameter is cheaper to instantiate and mangle than the
+	// <sign, mantissa, exponent> triple of ::bcl::detail::double_, and both
+	// kinds of bounds can be mixed freely since only ::value is used.
+	template <::std::uint64_t Bits>
+	struct double_{
+		using type = double_;
+		using value_type = double;
+
+		static constexpr double value = detail::bits_to_double(Bits);
+
+		constexpr operator double() const
+		{
+			return value;
+		}
+	};
+
+	template <::std::uint64_t Bits>
+	constexpr double double_<Bits>::value;
+
+	// true for cti::double_ and for the bcl encoded doubles
+	template <typename T>
+	struct is_encoded_double : ::std::integral_constant<bool, ::bcl::is_encoded_double_v<T>>{
+	};
+
+	template <::std::uint64_t Bits>
+	struct is_encoded_double<double_<Bits>> : ::std::true_type{
+	};
+
+	template <typename T>
+	constexpr bool is_encoded_double_v = is_encoded_double<T>{};
+
+	// adapters between the two encodings, for code that expects one of them
+	template <typename T>
+	using to_bcl_t = BCL_DOUBLE_T(T::value);
+
+	template <typename T>
+	using from_bcl_t = double_<detail::double_to_bits(T::value)>;
+}
+
+#define CTI_DOUBLE(x) ::cti::double_<::cti::detail::double_to_bits(x)>
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <utility>
+#include <tuple>
+#include <type_traits>
+
+#include <bcl/double.hpp>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+
+namespace cti{
+	// lazy expression over cti::interval
+	//
+	// the operators on cti::interval encode every intermediate result into
+	// a new interval<...> type.  an expression built from cti::lazy(x) only
+	// records the operator tree and cti::eval() encodes the final result
+	// only.
+	//
+	// every node keeps its value in a static member computed from the values
+	// of its operands, which are complete by the time the node is formed.  no
+	// constant expression therefore recurses over the depth of the tree, which
+	// would exceed the constexpr depth limit of the compiler (512 by default
+	// on GCC) on long chains.
+	//
+	// the type of a node spells out its whole subtree.  without optimization
+	// the operators are emitted as functions whose mangled names grow with
+	// the depth, so the object file grows quadratically with the length of
+	// the chain; with -O1 and above they are inlined and discarded.
+	//
+	//     constexpr auto r = cti::eval(cti::lazy(x) + y * z);
+
+	template <typename E>
+	struct expr{
+		using node_type = E;
+
+		// forms the node, see above
+		using value_type = typename E::value_type;
+	};
+
+	template <typename T>
+	struct is_expr : ::std::false_type{
+	};
+
+	template <typename E>
+	struct is_expr<expr<E>> : ::std::true_type{
+	};
+
+	template <typename T>
+	constexpr bool is_expr_v = is_expr<T>{};
+
+	namespace detail{
+		template <typename Inf, typename Sup>
+		struct expr_interval{
+			using value_type = typename Inf::value_type;
+
+			static constexpr ::std::pair<value_type, value_type> value{Inf::value, Sup::value};
+		};
+
+		template <typename Inf, typename Sup>
+		constexpr ::std::pair<typename Inf::value_type, typename Inf::value_type> expr_interval<Inf, Sup>::value;
+
+		template <typename T>
+		struct expr_scalar{
+			using value_type = typename T::value_type;
+
+			static constexpr ::std::pair<value_type, value_type> value{T::value, T::value};
+		};
+
+		template <typename T>
+		constexpr ::std::pair<typename T::value_type, typename T::value_type> expr_scalar<T>::value;
+
+		struct expr_add{
+			template <typename T>
+			static constexpr ::std::pair<T, T>
+			apply(const ::std::pair<T, T> &x, const ::std::pair<T, T> &y)
+			{
+				return interval_operator_add_impl1(
+					::std::get<0>(x), ::std::get<1>(x),
+					::std::get<0>(y), ::std::get<1>(y));
+			}
+		};
+
+		struct expr_sub{
+			template <typename T>
+			static constexpr ::std::pair<T, T>
+			apply(const ::std::pair<T, T> &x, const ::std::pair<T, T> &y)
+			{
+				return interval_operator_sub_impl1(
+					::std::get<0>(x), ::std::get<1>(x),
+					::std::get<0>(y), ::std::get<1>(y));
+			}
+		};
+
+		struct expr_mul{
+			template <typename T>
+			static constexpr ::std::pair<T, T>
+			apply(const ::std::pair<T, T> &x, const ::std::pair<T, T> &y)
+			{
+				return interval_operator_mul_impl1(
+					::std::get<0>(x), ::std::get<1>(x),
+					::std::get<0>(y), ::std::get<1>(y));
+			}
+		};
+
+		struct expr_div{
+			template <typename T>
+			static constexpr ::std::pair<T, T>
+			apply(const ::std::pair<T, T> &x, const ::std::pair<T, T> &y)
+			{
+				return interval_operator_div_impl1(
+					::std::get<0>(x), ::std::get<1>(x),
+					::std::get<0>(y), ::std::get<1>(y));
+			}
+		};
+
+		template <typename Op, typename L, typename R>
+		struct expr_binary{
+			static_assert(::std::is_same<typename L::value_type, typename R::value_type>{},
+			              "both operands of cti::expr must have the same value type");
+
+			using value_type = typename L::value_type;
+
+			static constexpr ::std::pair<value_type, value_type> value = Op::apply(L::value, R::value);
+
+			// the initializer of value is instantiated on first use only; the
+			// assertion evaluates it when the node is formed, while L::value
+			// and R::value are already known
+			static_assert(!(::std::get<1>(value) < ::std::get<0>(value)), "cti::expr: lower bound above upper bound");
+		};
+
+		template <typename Op, typename L, typename R>
+		constexpr ::std::pair<typename L::value_type, typename L::value_type> expr_binary<Op, L, R>::value;
+
+		template <typename E>
+		struct expr_neg{
+			using value_type = typename E::value_type;
+
+			static constexpr ::std::pair<value_type, value_type> value{-::std::get<1>(E::value), -::std::get<0>(E::value)};
+
+			static_assert(!(::std::get<1>(value) < ::std::get<0>(value)), "cti::expr: lower bound above upper bound");
+		};
+
+		template <typename E>
+		constexpr ::std::pair<typename E::value_type, typename E::value_type> expr_neg<E>::value;
+
+		// maps an operand of an expression operator to its node type
+		template <typename T, typename = void>
+		struct expr_node;
+
+		template <typename E>
+		struct expr_node<expr<E>>{
+			using type = E;
+		};
+
+		template <typename Inf, typename Sup>
+		struct expr_node<interval<Inf, Sup>>{
+			using type = expr_interval<Inf, Sup>;
+		};
+
+		template <typename T>
+		struct expr_node<T, ::std::enable_if_t<::cti::is_encoded_double<T>{}>>{
+			using type = expr_scalar<T>;
+		};
+
+		template <typename T>
+		using expr_node_t = typename expr_node<T>::type;
+
+		// at least one operand is an expr, the other one is an expr,
+		// an interval or an encoded double
+		template <typename T1, typename T2>
+		using enable_if_expr_operands_t = ::std::enable_if_t<
+			(is_expr<T1>{} || is_expr<T2>{})
+			&& (is_expr<T1>{} || is_interval<T1>{} || ::cti::is_encoded_double<T1>{})
+			&& (is_expr<T2>{} || is_interval<T2>{} || ::cti::is_encoded_double<T2>{})
+		>;
+
+		template <typename Op, typename T1, typename T2>
+		using expr_binary_t = expr<expr_binary<Op, expr_node_t<T1>, expr_node_t<T2>>>;
+	}
+
+	template <typename Inf, typename Sup>
+	constexpr expr<detail::expr_interval<Inf, Sup>> lazy(interval<Inf, Sup>)
+	{
+		return {};
+	}
+
+	template <typename T1, typename T2, detail::enable_if_expr_operands_t<T1, T2>* = nullptr>
+	constexpr detail::expr_binary_t<detail::expr_add, T1, T2> operator+(T1, T2)
+	{
+		return {};
+	}
+
+	template <typename T1, typename T2, detail::enable_if_expr_operands_t<T1, T2>* = nullptr>
+	constexpr detail::expr_binary_t<detail::expr_sub, T1, T2> operator-(T1, T2)
+	{
+		return {};
+	}
+
+	template <typename T1, typename T2, detail::enable_if_expr_operands_t<T1, T2>* = nullptr>
+	constexpr detail::expr_binary_t<detail::expr_mul, T1, T2> operator*(T1, T2)
+	{
+		return {};
+	}
+
+	template <typename T1, typename T2, detail::enable_if_expr_operands_t<T1, T2>* = nullptr>
+	constexpr detail::expr_binary_t<detail::expr_div, T1, T2> operator/(T1, T2)
+	{
+		return {};
+	}
+
+	template <typename E>
+	constexpr expr<detail::expr_neg<E>> operator-(expr<E>)
+	{
+		return {};
+	}
+
+	template <typename E>
+	constexpr auto eval(expr<E>)
+	{
+		constexpr auto result = E::value;
+
+		constexpr auto inf = detail::double_to_bits(::std::get<0>(result));
+		constexpr auto sup = detail::double_to_bits(::std::get<1>(result));
+
+		return interval<double_<inf>, double_<sup>>{};
+	}
+}
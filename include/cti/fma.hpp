@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cmath>
+#include <utility>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+
+namespace cti{
+	// runtime-only variant of trait<double> whose twoproduct computes the
+	// error term with a fused multiply-add instead of Dekker's splitting.
+	// the error term is the same whenever twoproduct is used by the
+	// directed operations, so the results are identical to trait<double>.
+	//
+	// std::fma is only fast when the compiler may emit fma instructions
+	// (-mfma, or a function compiled with target("fma")).  use
+	// runtime_trait to get the best variant for the current build.
+	struct fma_trait : detail::rdouble_trait<fma_trait>{
+		static ::std::pair<double, double>
+		twoproduct(double a, double b)
+		{
+			double x = a * b;
+			double y = ::std::fma(a, b, -x);
+
+			return {x, y};
+		}
+	};
+
+	namespace detail{
+		inline bool cpu_has_fma()
+		{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+			return __builtin_cpu_supports("fma");
+#else
+			return false;
+#endif
+		}
+
+		struct rdouble_ops{
+			double (*mul_up)(double, double);
+			double (*mul_down)(double, double);
+			double (*div_up)(double, double);
+			double (*div_down)(double, double);
+			double (*sqrt_up)(double);
+			double (*sqrt_down)(double);
+		};
+
+		template <typename Trait>
+		struct rdouble_ops_of{
+			static double mul_up(double x, double y){ return Trait::mul_up(x, y); }
+			static double mul_down(double x, double y){ return Trait::mul_down(x, y); }
+			static double div_up(double x, double y){ return Trait::div_up(x, y); }
+			static double div_down(double x, double y){ return Trait::div_down(x, y); }
+			static double sqrt_up(double x){ return Trait::sqrt_up(x); }
+			static double sqrt_down(double x){ return Trait::sqrt_down(x); }
+
+			static constexpr rdouble_ops table()
+			{
+				return {mul_up, mul_down, div_up, div_down, sqrt_up, sqrt_down};
+			}
+		};
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+		// fma_trait compiled for fma-capable processors.  flatten inlines
+		// fma_trait into the wrapper so that std::fma becomes an instruction.
+# define CTI_FMA_TARGET __attribute__((target("fma"), flatten))
+
+		struct rdouble_ops_fma{
+			CTI_FMA_TARGET static double mul_up(double x, double y){ return fma_trait::mul_up(x, y); }
+			CTI_FMA_TARGET static double mul_down(double x, double y){ return fma_trait::mul_down(x, y); }
+			CTI_FMA_TARGET static double div_up(double x, double y){ return fma_trait::div_up(x, y); }
+			CTI_FMA_TARGET static double div_down(double x, double y){ return fma_trait::div_down(x, y); }
+			CTI_FMA_TARGET static double sqrt_up(double x){ return fma_trait::sqrt_up(x); }
+			CTI_FMA_TARGET static double sqrt_down(double x){ return fma_trait::sqrt_down(x); }
+
+			static constexpr rdouble_ops table()
+			{
+				return {mul_up, mul_down, div_up, div_down, sqrt_up, sqrt_down};
+			}
+		};
+
+# undef CTI_FMA_TARGET
+#else
+		using rdouble_ops_fma = rdouble_ops_of<trait<double>>;
+#endif
+
+		inline const rdouble_ops &runtime_rdouble_ops()
+		{
+			static const rdouble_ops ops = cpu_has_fma()
+				? rdouble_ops_fma::table()
+				: rdouble_ops_of<trait<double>>::table();
+			return ops;
+		}
+	}
+
+	// trait<double> whose multiplication, division and sqrt are selected
+	// once at run time depending on whether the processor supports fma
+	struct dispatch_trait : trait<double>{
+		static double mul_up(double x, double y){ return detail::runtime_rdouble_ops().mul_up(x, y); }
+		static double mul_down(double x, double y){ return detail::runtime_rdouble_ops().mul_down(x, y); }
+		static double div_up(double x, double y){ return detail::runtime_rdouble_ops().div_up(x, y); }
+		static double div_down(double x, double y){ return detail::runtime_rdouble_ops().div_down(x, y); }
+		static double sqrt_up(double x){ return detail::runtime_rdouble_ops().sqrt_up(x); }
+		static double sqrt_down(double x){ return detail::runtime_rdouble_ops().sqrt_down(x); }
+	};
+
+	// the fastest trait for run-time evaluation in this build
+#if defined(__FMA__) || defined(__FP_FAST_FMA)
+	using runtime_trait = fma_trait;
+#else
+	using runtime_trait = dispatch_trait;
+#endif
+}
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <cfenv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <tuple>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+
+namespace cti{
+	// sets the rounding mode to upward for the lifetime of the object and
+	// restores the previous mode afterwards
+	class rounding_upward{
+		int mode;
+
+	public:
+		rounding_upward()
+			: mode(::std::fegetround())
+		{
+			::std::fesetround(FE_UPWARD);
+		}
+
+		rounding_upward(const rounding_upward &) = delete;
+		rounding_upward &operator=(const rounding_upward &) = delete;
+
+		~rounding_upward()
+		{
+			::std::fesetround(mode);
+		}
+	};
+
+	namespace detail{
+		// an opaque copy of x.  wrapping the operands and the result of an
+		// operation keeps the compiler from folding it (-(-x - y) into x + y,
+		// or constants in the default rounding mode) and from moving it
+		// across the fesetround calls of rounding_upward.
+		inline double hwround_opaque(double x)
+		{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+			asm volatile("" : "+x"(x));
+#else
+			volatile double v = x;
+			x = v;
+#endif
+			return x;
+		}
+	}
+
+	// runtime-only trait<double> policy for code running under
+	// rounding_upward: the upper bounds are plain operations and the lower
+	// bounds are -((-a) op b), so a whole block of interval operations pays
+	// for a single mode switch instead of the error-free transformations of
+	// trait<double>.  only the directed operations are provided; the
+	// results are meaningless in any other rounding mode.
+	//
+	//     {
+	//         cti::rounding_upward upward;
+	//         for(...)
+	//             z[i] = x[i] * y[i] + x[i];  // rinterval<double, cti::hwround_trait>
+	//     }
+	struct hwround_trait{
+		static void print_up(double x, ::std::ostream &os)
+		{
+			trait<double>::print_up(x, os);
+		}
+
+		static void print_down(double x, ::std::ostream &os)
+		{
+			trait<double>::print_down(x, os);
+		}
+
+		static double add_up(double x, double y)
+		{
+			using detail::hwround_opaque;
+			return hwround_opaque(hwround_opaque(x) + hwround_opaque(y));
+		}
+
+		static double add_down(double x, double y)
+		{
+			using detail::hwround_opaque;
+			return -hwround_opaque(hwround_opaque(-x) - hwround_opaque(y));
+		}
+
+		static double sub_up(double x, double y)
+		{
+			using detail::hwround_opaque;
+			return hwround_opaque(hwround_opaque(x) - hwround_opaque(y));
+		}
+
+		static double sub_down(double x, double y)
+		{
+			using detail::hwround_opaque;
+			return -hwround_opaque(hwround_opaque(y) - hwround_opaque(x));
+		}
+
+		static double mul_up(double x, double y)
+		{
+			using detail::hwround_opaque;
+			return hwround_opaque(hwround_opaque(x) * hwround_opaque(y));
+		}
+
+		static double mul_down(double x, double y)
+		{
+			using detail::hwround_opaque;
+			return -hwround_opaque(hwround_opaque(-x) * hwround_opaque(y));
+		}
+
+		static double div_up(double x, double y)
+		{
+			using detail::hwround_opaque;
+			return hwround_opaque(hwround_opaque(x) / hwround_opaque(y));
+		}
+
+		static double div_down(double x, double y)
+		{
+			using detail::hwround_opaque;
+			return -hwround_opaque(hwround_opaque(-x) / hwround_opaque(y));
+		}
+
+		static double sqrt_up(double x)
+		{
+			using detail::hwround_opaque;
+			return hwround_opaque(::std::sqrt(hwround_opaque(x)));
+		}
+
+		// sqrt_up(x) is exact iff its square rounded upward is x; otherwise
+		// the lower bound is the preceding floating-point number
+		static double sqrt_down(double x)
+		{
+			double s = sqrt_up(x);
+			if(mul_up(s, s) == x)
+				return s;
+
+			::std::uint64_t bits;
+			::std::memcpy(&bits, &s, sizeof(double));
+			--bits;
+			::std::memcpy(&s, &bits, sizeof(double));
+			return s;
+		}
+	};
+
+	// batched interval operations on arrays of lower and upper bounds with
+	// hwround_trait, under a single rounding mode switch per call.  the
+	// bounds are equal to those of detail::batch_* and trait<double>, except
+	// that an exactly zero lower bound of a sum or difference is -0.
+	inline void hwround_add(::std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+	{
+		rounding_upward upward;
+
+		for(::std::size_t i = 0; i < n; ++i){
+			double lower = hwround_trait::add_down(inf1[i], inf2[i]);
+			double upper = hwround_trait::add_up(sup1[i], sup2[i]);
+			inf[i] = lower;
+			sup[i] = upper;
+		}
+	}
+
+	inline void hwround_sub(::std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+	{
+		rounding_upward upward;
+
+		for(::std::size_t i = 0; i < n; ++i){
+			double lower = hwround_trait::sub_down(inf1[i], sup2[i]);
+			double upper = hwround_trait::sub_up(sup1[i], inf2[i]);
+			inf[i] = lower;
+			sup[i] = upper;
+		}
+	}
+
+	inline void hwround_mul(::std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+	{
+		rounding_upward upward;
+
+		for(::std::size_t i = 0; i < n; ++i){
+			auto result = detail::interval_operator_mul_impl1<double, hwround_trait>(inf1[i], sup1[i], inf2[i], sup2[i]);
+			inf[i] = ::std::get<0>(result);
+			sup[i] = ::std::get<1>(result);
+		}
+	}
+
+	inline void hwround_div(::std::size_t n, const double *inf1, const double *sup1, const double *inf2, const double *sup2, double *inf, double *sup)
+	{
+		rounding_upward upward;
+
+		for(::std::size_t i = 0; i < n; ++i){
+			auto result = detail::interval_operator_div_impl1<double, hwround_trait>(inf1[i], sup1[i], inf2[i], sup2[i]);
+			inf[i] = ::std::get<0>(result);
+			sup[i] = ::std::get<1>(result);
+		}
+	}
+
+	inline void hwround_sqrt(::std::size_t n, const double *inf1, const double *sup1, double *inf, double *sup)
+	{
+		rounding_upward upward;
+
+		for(::std::size_t i = 0; i < n; ++i){
+			if(!(inf1[i] >= 0.0))
+				throw ::std::domain_error("cti::hwround_sqrt: sqrt of negative value");
+
+			double lower = hwround_trait::sqrt_down(inf1[i]);
+			double upper = hwround_trait::sqrt_up(sup1[i]);
+			inf[i] = lower;
+			sup[i] = upper;
+		}
+	}
+}
@@ -1,16 +1,25 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <ostream>
 #include <utility>
+#include <tuple>
+#include <limits>
 #include <stdexcept>
+#include <type_traits>
 
 #include <boost/preprocessor/facilities/overload.hpp>
 
+#include <sprout/math/fabs.hpp>
+
 #include <kv/interval.hpp>
 #include <kv/rdouble.hpp>
 
 #include <bcl/double.hpp>
 
+#include <cti/double.hpp>
+
 namespace cti{
 	template <typename T>
 	struct trait{
@@ -75,23 +84,45 @@ namespace cti{
 	constexpr bool is_interval_v = is_interval<T>{};
 
 	namespace detail{
+		// T is an encoded scalar such as D_T(x) or CTI_DOUBLE(x), which has a
+		// static value
+		template <typename T, typename = void>
+		struct has_static_value : ::std::false_type{
+		};
+
 		template <typename T>
+		struct has_static_value<T, ::std::enable_if_t<(sizeof(T::value) > 0)>> : ::std::true_type{
+		};
+
+		template <typename T, typename Trait = trait<T>>
+		constexpr ::std::pair<T, T>
+		interval_operator_add_impl1(const T &inf1, const T &sup1, const T &inf2, const T &sup2);
+
+		template <typename T, typename Trait = trait<T>>
+		constexpr ::std::pair<T, T>
+		interval_operator_sub_impl1(const T &inf1, const T &sup1, const T &inf2, const T &sup2);
+
+		template <typename T, typename Trait = trait<T>>
 		constexpr ::std::pair<T, T>
 		interval_operator_mul_impl1(const T &inf1, const T &sup1, const T &inf2, const T &sup2);
 
-		template <typename T>
+		template <typename T, typename Trait = trait<T>>
+		constexpr ::std::pair<T, T>
+		interval_operator_mul_impl1_minmax(const T &inf1, const T &sup1, const T &inf2, const T &sup2);
+
+		template <typename T, typename Trait = trait<T>>
 		constexpr ::std::pair<T, T>
 		interval_operator_mul_impl2(const T &inf1, const T &sup1, const T &x);
 
-		template <typename T>
+		template <typename T, typename Trait = trait<T>>
 		constexpr ::std::pair<T, T>
 		interval_operator_div_impl1(const T &inf1, const T &sup1, const T &inf2, const T &sup2);
 
-		template <typename T>
+		template <typename T, typename Trait = trait<T>>
 		constexpr ::std::pair<T, T>
 		interval_operator_div_impl2(const T &inf1, const T &sup1, const T &y);
 
-		template <typename T>
+		template <typename T, typename Trait = trait<T>>
 		constexpr ::std::pair<T, T>
 		interval_operator_div_impl3(const T &x, const T &inf2, const T &sup2);
 	}
@@ -99,6 +130,60 @@ namespace cti{
 	template <typename Inf, typename Sup>
 	struct interval;
 
+	namespace detail{
+		// encoding of the bounds of type T as types.  a bound is stored as
+		// the bit patterns of its leading and trailing doubles, so that a
+		// value type wider than double (cti::dd in cti/dd.hpp) fits the same
+		// template parameters; the trailing part of a double is 0.
+		// kv_type is the bound type of the corresponding kv::interval.
+		template <typename T>
+		struct bound;
+
+		template <>
+		struct bound<double>{
+			using kv_type = double;
+
+			template <::std::uint64_t Leading, ::std::uint64_t>
+			using type = double_<Leading>;
+
+			static constexpr ::std::uint64_t leading(double x)
+			{
+				return double_to_bits(x);
+			}
+
+			static constexpr ::std::uint64_t trailing(double)
+			{
+				return 0;
+			}
+
+			static double to_kv(double x)
+			{
+				return x;
+			}
+		};
+
+		template <typename T, typename = void>
+		struct has_bound : ::std::false_type{
+		};
+
+		template <typename T>
+		struct has_bound<T, ::std::enable_if_t<(sizeof(bound<T>) > 0)>> : ::std::true_type{
+		};
+
+		template <
+			typename T,
+			::std::uint64_t InfLeading, ::std::uint64_t InfTrailing,
+			::std::uint64_t SupLeading, ::std::uint64_t SupTrailing
+		>
+		using bound_interval_t = interval<
+			typename bound<T>::template type<InfLeading, InfTrailing>,
+			typename bound<T>::template type<SupLeading, SupTrailing>>;
+
+		// the encoded scalar of the same representation
+		template <typename T, ::std::uint64_t Leading, ::std::uint64_t Trailing>
+		using bound_t = typename bound<T>::template type<Leading, Trailing>;
+	}
+
 	template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
 	constexpr bool overlap(interval<Inf1, Sup1>, interval<Inf2, Sup2>);
 
@@ -107,18 +192,18 @@ namespace cti{
 		static_assert(::std::is_same<typename Inf::value_type, typename Sup::value_type>{},
 		              "Inf and Sup must contain the same type");
 
-		static_assert(::std::is_same<typename Inf::value_type, double>{},
-		              "currently, cti::interval supports only double as internal types of Inf and Sup");
+		static_assert(detail::has_bound<typename Inf::value_type>{},
+		              "cti::interval supports only double and cti::dd as internal types of Inf and Sup");
 
 		using value_type = typename Inf::value_type;
+		using kv_type = typename detail::bound<value_type>::kv_type;
 
-		operator ::kv::interval<typename Inf::value_type>() const
+		operator ::kv::interval<kv_type>() const
 		{
-			double inf = Inf::value, sup = Sup::value;
-			return {inf, sup};
+			return {detail::bound<value_type>::to_kv(Inf::value), detail::bound<value_type>::to_kv(Sup::value)};
 		}
 
-		::kv::interval<typename Inf::value_type> to_kv() const
+		::kv::interval<kv_type> to_kv() const
 		{
 			return *this;
 		}
@@ -146,15 +231,21 @@ namespace cti{
 			return os;
 		}
 
-		template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
-		friend constexpr auto operator+(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
+		template <typename Inf2, typename Sup2>
+		friend constexpr auto operator+(interval, interval<Inf2, Sup2>)
 		{
-			using common_t = ::std::common_type_t<typename Inf1::value_type, typename Inf2::value_type>;
+			using common_t = ::std::common_type_t<typename Inf::value_type, typename Inf2::value_type>;
 
-			constexpr auto inf = ::bcl::encode(trait<common_t>::add_down(Inf1::value, Inf2::value));
-			constexpr auto sup = ::bcl::encode(trait<common_t>::add_up(Sup1::value, Sup2::value));
+			constexpr auto result = detail::interval_operator_add_impl1(
+				static_cast<common_t>(Inf::value), static_cast<common_t>(Sup::value),
+				static_cast<common_t>(Inf2::value), static_cast<common_t>(Sup2::value));
 
-			return interval<BCL_DOUBLE(inf), BCL_DOUBLE(sup)>{};
+			constexpr auto inf = ::std::get<0>(result);
+			constexpr auto sup = ::std::get<1>(result);
+
+			return detail::bound_interval_t<common_t,
+				detail::bound<common_t>::leading(inf), detail::bound<common_t>::trailing(inf),
+				detail::bound<common_t>::leading(sup), detail::bound<common_t>::trailing(sup)>{};
 		}
 
 		template <
@@ -162,16 +253,19 @@ namespace cti{
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
 				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr auto operator+(interval, T)
 		{
 			using common_t = ::std::common_type_t<typename T::value_type, value_type>;
 
-			constexpr auto inf = ::bcl::encode(trait<common_t>::add_down(Inf::value, common_t(T::value)));
-			constexpr auto sup = ::bcl::encode(trait<common_t>::add_up(Sup::value, common_t(T::value)));
+			constexpr auto inf = trait<common_t>::add_down(Inf::value, common_t(T::value));
+			constexpr auto sup = trait<common_t>::add_up(Sup::value, common_t(T::value));
 
-			return interval<BCL_DOUBLE(inf), BCL_DOUBLE(sup)>{};
+			return detail::bound_interval_t<common_t,
+				detail::bound<common_t>::leading(inf), detail::bound<common_t>::trailing(inf),
+				detail::bound<common_t>::leading(sup), detail::bound<common_t>::trailing(sup)>{};
 		}
 
 		template <
@@ -179,6 +273,7 @@ namespace cti{
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
 				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr auto operator+(T x, interval y)
@@ -186,15 +281,21 @@ namespace cti{
 			return y + x;
 		}
 
-		template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
-		friend constexpr auto operator-(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
+		template <typename Inf2, typename Sup2>
+		friend constexpr auto operator-(interval, interval<Inf2, Sup2>)
 		{
-			using common_t = ::std::common_type_t<typename Inf1::value_type, typename Inf2::value_type>;
+			using common_t = ::std::common_type_t<typename Inf::value_type, typename Inf2::value_type>;
 
-			constexpr auto inf = ::bcl::encode(trait<common_t>::sub_down(Inf1::value, Inf2::value));
-			constexpr auto sup = ::bcl::encode(trait<common_t>::sub_up(Sup1::value, Sup2::value));
+			constexpr auto result = detail::interval_operator_sub_impl1(
+				static_cast<common_t>(Inf::value), static_cast<common_t>(Sup::value),
+				static_cast<common_t>(Inf2::value), static_cast<common_t>(Sup2::value));
+
+			constexpr auto inf = ::std::get<0>(result);
+			constexpr auto sup = ::std::get<1>(result);
 
-			return interval<BCL_DOUBLE(inf), BCL_DOUBLE(sup)>{};
+			return detail::bound_interval_t<common_t,
+				detail::bound<common_t>::leading(inf), detail::bound<common_t>::trailing(inf),
+				detail::bound<common_t>::leading(sup), detail::bound<common_t>::trailing(sup)>{};
 		}
 
 		template <
@@ -202,16 +303,19 @@ namespace cti{
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
 				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr auto operator-(interval, T)
 		{
 			using common_t = ::std::common_type_t<typename T::value_type, value_type>;
 
-			constexpr auto inf = ::bcl::encode(trait<common_t>::sub_down(Inf::value, common_t(T::value)));
-			constexpr auto sup = ::bcl::encode(trait<common_t>::sub_up(Sup::value, common_t(T::value)));
+			constexpr auto inf = trait<common_t>::sub_down(Inf::value, common_t(T::value));
+			constexpr auto sup = trait<common_t>::sub_up(Sup::value, common_t(T::value));
 
-			return interval<BCL_DOUBLE(inf), BCL_DOUBLE(sup)>{};
+			return detail::bound_interval_t<common_t,
+				detail::bound<common_t>::leading(inf), detail::bound<common_t>::trailing(inf),
+				detail::bound<common_t>::leading(sup), detail::bound<common_t>::trailing(sup)>{};
 		}
 
 		template <
@@ -219,23 +323,32 @@ namespace cti{
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
 				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
-		friend constexpr auto operator-(T x, interval y)
+		friend constexpr auto operator-(T, interval)
 		{
 			using common_t = ::std::common_type_t<typename T::value_type, value_type>;
 
-			constexpr auto inf = ::bcl::encode(trait<common_t>::sub_down(common_t(T::value), Inf::value));
-			constexpr auto sup = ::bcl::encode(trait<common_t>::sub_up(common_t(T::value), Sup::value));
+			constexpr auto result = detail::interval_operator_sub_impl1(
+				common_t(T::value), common_t(T::value),
+				static_cast<common_t>(Inf::value), static_cast<common_t>(Sup::value));
+
+			constexpr auto inf = ::std::get<0>(result);
+			constexpr auto sup = ::std::get<1>(result);
 
-			return interval<BCL_DOUBLE(inf), BCL_DOUBLE(sup)>{};
+			return detail::bound_interval_t<common_t,
+				detail::bound<common_t>::leading(inf), detail::bound<common_t>::trailing(inf),
+				detail::bound<common_t>::leading(sup), detail::bound<common_t>::trailing(sup)>{};
 		}
 
 		friend constexpr auto operator-(interval)
 		{
-			constexpr auto inf = ::bcl::encode(-Sup::value);
-			constexpr auto sup = ::bcl::encode(-Inf::value);
-			return interval<BCL_DOUBLE(inf), BCL_DOUBLE(sup)>{};
+			constexpr auto inf = -Sup::value;
+			constexpr auto sup = -Inf::value;
+			return detail::bound_interval_t<value_type,
+				detail::bound<value_type>::leading(inf), detail::bound<value_type>::trailing(inf),
+				detail::bound<value_type>::leading(sup), detail::bound<value_type>::trailing(sup)>{};
 		}
 
 		template <typename T>
@@ -245,19 +358,21 @@ namespace cti{
 			return ::std::make_tuple(inf1, sup1);
 		}
 
-		template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
-		friend constexpr auto operator*(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
+		template <typename Inf2, typename Sup2>
+		friend constexpr auto operator*(interval, interval<Inf2, Sup2>)
 		{
-			using common_t = ::std::common_type_t<typename Inf1::value_type, typename Inf2::value_type>;
+			using common_t = ::std::common_type_t<typename Inf::value_type, typename Inf2::value_type>;
 
 			constexpr auto result = detail::interval_operator_mul_impl1(
-				static_cast<common_t>(Inf1::value), static_cast<common_t>(Sup1::value),
+				static_cast<common_t>(Inf::value), static_cast<common_t>(Sup::value),
 				static_cast<common_t>(Inf2::value), static_cast<common_t>(Sup2::value));
 
-			constexpr auto inf = ::bcl::encode(::std::get<0>(result));
-			constexpr auto sup = ::bcl::encode(::std::get<1>(result));
+			constexpr auto inf = ::std::get<0>(result);
+			constexpr auto sup = ::std::get<1>(result);
 
-			return interval<BCL_DOUBLE(inf), BCL_DOUBLE(sup)>{};
+			return detail::bound_interval_t<common_t,
+				detail::bound<common_t>::leading(inf), detail::bound<common_t>::trailing(inf),
+				detail::bound<common_t>::leading(sup), detail::bound<common_t>::trailing(sup)>{};
 		}
 
 		template <
@@ -265,6 +380,7 @@ namespace cti{
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
 				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr auto operator*(interval, T)
@@ -275,10 +391,12 @@ namespace cti{
 				static_cast<common_t>(Inf::value), static_cast<common_t>(Sup::value),
 				static_cast<common_t>(T::value));
 
-			constexpr auto inf = ::bcl::encode(::std::get<0>(result));
-			constexpr auto sup = ::bcl::encode(::std::get<1>(result));
+			constexpr auto inf = ::std::get<0>(result);
+			constexpr auto sup = ::std::get<1>(result);
 
-			return interval<BCL_DOUBLE(inf), BCL_DOUBLE(sup)>{};
+			return detail::bound_interval_t<common_t,
+				detail::bound<common_t>::leading(inf), detail::bound<common_t>::trailing(inf),
+				detail::bound<common_t>::leading(sup), detail::bound<common_t>::trailing(sup)>{};
 		}
 
 		template <
@@ -286,6 +404,7 @@ namespace cti{
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
 				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr auto operator*(T x, interval y)
@@ -293,19 +412,21 @@ namespace cti{
 			return y * x;
 		}
 
-		template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
-		friend constexpr auto operator/(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
+		template <typename Inf2, typename Sup2>
+		friend constexpr auto operator/(interval, interval<Inf2, Sup2>)
 		{
-			using common_t = ::std::common_type_t<typename Inf1::value_type, typename Inf2::value_type>;
+			using common_t = ::std::common_type_t<typename Inf::value_type, typename Inf2::value_type>;
 
 			constexpr auto result = detail::interval_operator_div_impl1(
-				static_cast<common_t>(Inf1::value), static_cast<common_t>(Sup1::value),
+				static_cast<common_t>(Inf::value), static_cast<common_t>(Sup::value),
 				static_cast<common_t>(Inf2::value), static_cast<common_t>(Sup2::value));
 
-			constexpr auto inf = ::bcl::encode(::std::get<0>(result));
-			constexpr auto sup = ::bcl::encode(::std::get<1>(result));
+			constexpr auto inf = ::std::get<0>(result);
+			constexpr auto sup = ::std::get<1>(result);
 
-			return interval<BCL_DOUBLE(inf), BCL_DOUBLE(sup)>{};
+			return detail::bound_interval_t<common_t,
+				detail::bound<common_t>::leading(inf), detail::bound<common_t>::trailing(inf),
+				detail::bound<common_t>::leading(sup), detail::bound<common_t>::trailing(sup)>{};
 		}
 
 		template <
@@ -313,6 +434,7 @@ namespace cti{
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
 				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr auto operator/(interval, T)
@@ -323,10 +445,12 @@ namespace cti{
 				static_cast<common_t>(Inf::value), static_cast<common_t>(Sup::value),
 				static_cast<common_t>(T::value));
 
-			constexpr auto inf = ::bcl::encode(::std::get<0>(result));
-			constexpr auto sup = ::bcl::encode(::std::get<1>(result));
+			constexpr auto inf = ::std::get<0>(result);
+			constexpr auto sup = ::std::get<1>(result);
 
-			return interval<BCL_DOUBLE(inf), BCL_DOUBLE(sup)>{};
+			return detail::bound_interval_t<common_t,
+				detail::bound<common_t>::leading(inf), detail::bound<common_t>::trailing(inf),
+				detail::bound<common_t>::leading(sup), detail::bound<common_t>::trailing(sup)>{};
 		}
 
 		template <
@@ -334,9 +458,10 @@ namespace cti{
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
 				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
-		friend constexpr auto operator/(interval, T)
+		friend constexpr auto operator/(T, interval)
 		{
 			using common_t = ::std::common_type_t<typename T::value_type, value_type>;
 
@@ -344,16 +469,18 @@ namespace cti{
 				static_cast<common_t>(T::value),
 				static_cast<common_t>(Inf::value), static_cast<common_t>(Sup::value));
 
-			constexpr auto inf = ::bcl::encode(::std::get<0>(result));
-			constexpr auto sup = ::bcl::encode(::std::get<1>(result));
+			constexpr auto inf = ::std::get<0>(result);
+			constexpr auto sup = ::std::get<1>(result);
 
-			return interval<BCL_DOUBLE(inf), BCL_DOUBLE(sup)>{};
+			return detail::bound_interval_t<common_t,
+				detail::bound<common_t>::leading(inf), detail::bound<common_t>::trailing(inf),
+				detail::bound<common_t>::leading(sup), detail::bound<common_t>::trailing(sup)>{};
 		}
 
-		template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
-		friend constexpr bool operator<(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
+		template <typename Inf2, typename Sup2>
+		friend constexpr bool operator<(interval, interval<Inf2, Sup2>)
 		{
-			return Sup1::value < Inf2::value;
+			return Sup::value < Inf2::value;
 		}
 
 		template <
@@ -361,6 +488,7 @@ namespace cti{
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
 				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr bool operator<(interval, T)
@@ -373,17 +501,18 @@ namespace cti{
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
 				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
-		friend constexpr bool operator<(interval, T)
+		friend constexpr bool operator<(T, interval)
 		{
 			return static_cast<value_type>(T::value) < Inf::value;
 		}
 
-		template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
-		friend constexpr bool operator<=(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
+		template <typename Inf2, typename Sup2>
+		friend constexpr bool operator<=(interval, interval<Inf2, Sup2>)
 		{
-			return Sup1::value <= Inf2::value;
+			return Sup::value <= Inf2::value;
 		}
 
 		template <
@@ -391,6 +520,7 @@ namespace cti{
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
 				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr bool operator<=(interval, T)
@@ -403,23 +533,26 @@ namespace cti{
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
 				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
-		friend constexpr bool operator<=(interval, T)
+		friend constexpr bool operator<=(T, interval)
 		{
 			return static_cast<value_type>(T::value) <= Inf::value;
 		}
 
-		template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
-		friend constexpr bool operator>(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
+		template <typename Inf2, typename Sup2>
+		friend constexpr bool operator>(interval, interval<Inf2, Sup2>)
 		{
-			return Inf1::value > Sup2::value;
+			return Inf::value > Sup2::value;
 		}
 
 		template <
 			typename T,
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
+				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr bool operator>(interval, T)
@@ -431,6 +564,8 @@ namespace cti{
 			typename T,
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
+				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr bool operator>(T, interval)
@@ -438,16 +573,18 @@ namespace cti{
 			return static_cast<value_type>(T::value) > Sup::value;
 		}
 
-		template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
-		friend constexpr bool operator>=(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
+		template <typename Inf2, typename Sup2>
+		friend constexpr bool operator>=(interval, interval<Inf2, Sup2>)
 		{
-			return Inf1::value >= Sup2::value;
+			return Inf::value >= Sup2::value;
 		}
 
 		template <
 			typename T,
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
+				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr bool operator>=(interval, T)
@@ -459,6 +596,8 @@ namespace cti{
 			typename T,
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
+				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr bool operator>=(T, interval)
@@ -466,11 +605,11 @@ namespace cti{
 			return static_cast<value_type>(T::value) >= Sup::value;
 		}
 
-		template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
-		friend constexpr bool operator==(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
+		template <typename Inf2, typename Sup2>
+		friend constexpr bool operator==(interval, interval<Inf2, Sup2>)
 		{
-			return Inf1::value == Sup1::value
-				&& Sup1::value == Inf2::value
+			return Inf::value == Sup::value
+				&& Sup::value == Inf2::value
 				&& Inf2::value == Sup2::value;
 		}
 
@@ -478,6 +617,8 @@ namespace cti{
 			typename T,
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
+				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr bool operator==(interval, T)
@@ -490,6 +631,8 @@ namespace cti{
 			typename T,
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
+				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr bool operator==(T, interval)
@@ -498,8 +641,8 @@ namespace cti{
 				&& Sup::value == static_cast<value_type>(T::value);
 		}
 
-		template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
-		friend constexpr bool operator!=(interval<Inf1, Sup1> x, interval<Inf2, Sup2> y)
+		template <typename Inf2, typename Sup2>
+		friend constexpr bool operator!=(interval x, interval<Inf2, Sup2> y)
 		{
 			return !overlap(x, y);
 		}
@@ -508,12 +651,17 @@ namespace cti{
 			typename T,
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
+				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr bool operator!=(interval x, T)
 		{
-			constexpr auto value = ::bcl::encode(T::value);
-			using y = BCL_DOUBLE(value);
+			using common_t = ::std::common_type_t<typename T::value_type, value_type>;
+			constexpr auto value = static_cast<common_t>(T::value);
+			using y = detail::bound_interval_t<common_t,
+				detail::bound<common_t>::leading(value), detail::bound<common_t>::trailing(value),
+				detail::bound<common_t>::leading(value), detail::bound<common_t>::trailing(value)>;
 
 			return !overlap(x, y{});
 		}
@@ -522,12 +670,17 @@ namespace cti{
 			typename T,
 			::std::enable_if_t<
 				::std::is_convertible<typename T::value_type, value_type>{}
+				&& !is_interval<T>{}
+				&& detail::has_static_value<T>{}
 			>* = nullptr
 		>
 		friend constexpr bool operator!=(T, interval y)
 		{
-			constexpr auto value = ::bcl::encode(T::value);
-			using x = BCL_DOUBLE(value);
+			using common_t = ::std::common_type_t<typename T::value_type, value_type>;
+			constexpr auto value = static_cast<common_t>(T::value);
+			using x = detail::bound_interval_t<common_t,
+				detail::bound<common_t>::leading(value), detail::bound<common_t>::trailing(value),
+				detail::bound<common_t>::leading(value), detail::bound<common_t>::trailing(value)>;
 
 			return !overlap(y, x{});
 		}
@@ -535,15 +688,29 @@ namespace cti{
 	};
 
 	namespace detail{
-		template <typename T>
+		template <typename T, typename Trait>
+		constexpr ::std::pair<T, T>
+		interval_operator_add_impl1(const T &inf1, const T &sup1, const T &inf2, const T &sup2)
+		{
+			return ::std::make_pair(Trait::add_down(inf1, inf2), Trait::add_up(sup1, sup2));
+		}
+
+		template <typename T, typename Trait>
+		constexpr ::std::pair<T, T>
+		interval_operator_sub_impl1(const T &inf1, const T &sup1, const T &inf2, const T &sup2)
+		{
+			return ::std::make_pair(Trait::sub_down(inf1, sup2), Trait::sub_up(sup1, inf2));
+		}
+
+		template <typename T, typename Trait>
 		constexpr ::std::pair<T, T>
 		interval_operator_mul_impl1(const T &inf1, const T &sup1, const T &inf2, const T &sup2)
 		{
-			constexpr double infinity = ::std::numeric_limits<T>::infinity();
+			constexpr T infinity = ::std::numeric_limits<T>::infinity();
 
 			using ::sprout::fabs;
 
-			double inf = 0.0, sup = 0.0;
+			T inf = 0.0, sup = 0.0;
 
 			if(inf1 >= 0.0){
 				if(sup1 == 0.0){
@@ -559,15 +726,15 @@ namespace cti{
 								sup = trait<T>::whole().upper();
 							}
 						}else{
-							inf = trait<T>::mul_down(inf1, inf2);
-							sup = trait<T>::mul_up(sup1, sup2);
+							inf = Trait::mul_down(inf1, inf2);
+							sup = Trait::mul_up(sup1, sup2);
 						}
 					}else if(sup2 <= 0.0){
-						inf = trait<T>::mul_down(sup1, inf2);
-						sup = trait<T>::mul_up(inf1, sup2);
+						inf = Trait::mul_down(sup1, inf2);
+						sup = Trait::mul_up(inf1, sup2);
 					}else{
-						inf = trait<T>::mul_down(sup1, inf2);
-						sup = trait<T>::mul_up(sup1, sup2);
+						inf = Trait::mul_down(sup1, inf2);
+						sup = Trait::mul_up(sup1, sup2);
 					}
 				}
 			}else if(sup1 <= 0.0){
@@ -578,15 +745,15 @@ namespace cti{
 							sup = trait<T>::whole().upper();
 						}
 					}else{
-						inf = trait<T>::mul_down(inf1, sup2);
-						sup = trait<T>::mul_up(sup1, inf2);
+						inf = Trait::mul_down(inf1, sup2);
+						sup = Trait::mul_up(sup1, inf2);
 					}
 				}else if(sup2 <= 0.0){
-					inf = trait<T>::mul_down(sup1, sup2);
-					sup = trait<T>::mul_up(inf1, inf2);
+					inf = Trait::mul_down(sup1, sup2);
+					sup = Trait::mul_up(inf1, inf2);
 				}else{
-					inf = trait<T>::mul_down(inf1, sup2);
-					sup = trait<T>::mul_up(inf1, inf2);
+					inf = Trait::mul_down(inf1, sup2);
+					sup = Trait::mul_up(inf1, inf2);
 				}
 			}else{
 				if(inf2 >= 0.0){
@@ -596,19 +763,19 @@ namespace cti{
 							sup = trait<T>::whole().upper();
 						}
 					}else{
-						inf = trait<T>::mul_down(inf1, sup2);
-						sup = trait<T>::mul_up(sup1, sup2);
+						inf = Trait::mul_down(inf1, sup2);
+						sup = Trait::mul_up(sup1, sup2);
 					}
 				}else if(sup2 <= 0.0){
-					inf = trait<T>::mul_down(sup1, inf2);
-					sup = trait<T>::mul_up(inf1, inf2);
+					inf = Trait::mul_down(sup1, inf2);
+					sup = Trait::mul_up(inf1, inf2);
 				}else{
-					inf = trait<T>::mul_down(inf1, sup2);
-					double tmp = trait<T>::mul_down(sup1, inf2);
+					inf = Trait::mul_down(inf1, sup2);
+					T tmp = Trait::mul_down(sup1, inf2);
 					if(tmp < inf)
 						inf = tmp;
-					sup = trait<T>::mul_up(inf1, inf2);
-					tmp = trait<T>::mul_up(sup1, sup2);
+					sup = Trait::mul_up(inf1, inf2);
+					tmp = Trait::mul_up(sup1, sup2);
 					if(tmp > sup)
 						sup = tmp;
 				}
@@ -618,6 +785,71 @@ namespace cti{
 		}
 
 		template <typename T>
+		constexpr T interval_operator_min(const T &x, const T &y)
+		{
+			return y < x ? y : x;
+		}
+
+		template <typename T>
+		constexpr T interval_operator_max(const T &x, const T &y)
+		{
+			return y > x ? y : x;
+		}
+
+		// Trait::mul_down and Trait::mul_up where 0 * inf is 0
+		template <typename T, typename Trait>
+		constexpr T interval_operator_mul_down0(const T &x, const T &y)
+		{
+			return x == 0.0 || y == 0.0 ? T(0.0) : Trait::mul_down(x, y);
+		}
+
+		template <typename T, typename Trait>
+		constexpr T interval_operator_mul_up0(const T &x, const T &y)
+		{
+			return x == 0.0 || y == 0.0 ? T(0.0) : Trait::mul_up(x, y);
+		}
+
+		// same result as interval_operator_mul_impl1 (up to the sign of zero)
+		// without branching on the signs of the operands: the bounds are the
+		// minimum and the maximum of the four directed products.
+		template <typename T, typename Trait>
+		constexpr ::std::pair<T, T>
+		interval_operator_mul_impl1_minmax(const T &inf1, const T &sup1, const T &inf2, const T &sup2)
+		{
+			constexpr T infinity = ::std::numeric_limits<T>::infinity();
+
+			using ::sprout::fabs;
+
+			T inf = interval_operator_min(
+				interval_operator_min(
+					interval_operator_mul_down0<T, Trait>(inf1, inf2),
+					interval_operator_mul_down0<T, Trait>(inf1, sup2)),
+				interval_operator_min(
+					interval_operator_mul_down0<T, Trait>(sup1, inf2),
+					interval_operator_mul_down0<T, Trait>(sup1, sup2)));
+
+			T sup = interval_operator_max(
+				interval_operator_max(
+					interval_operator_mul_up0<T, Trait>(inf1, inf2),
+					interval_operator_mul_up0<T, Trait>(inf1, sup2)),
+				interval_operator_max(
+					interval_operator_mul_up0<T, Trait>(sup1, inf2),
+					interval_operator_mul_up0<T, Trait>(sup1, sup2)));
+
+			// [0,0] times an unbounded interval is the whole line, as in
+			// interval_operator_mul_impl1
+			bool zero1 = inf1 >= 0.0 && sup1 == 0.0;
+			bool zero2 = inf2 >= 0.0 && sup2 == 0.0;
+			bool unbounded1 = fabs(inf1) == infinity || fabs(sup1) == infinity;
+			bool unbounded2 = fabs(inf2) == infinity || fabs(sup2) == infinity;
+			bool whole = (zero1 && unbounded2) || (zero2 && unbounded1);
+
+			return ::std::make_pair(
+				whole ? trait<T>::whole().lower() : inf,
+				whole ? trait<T>::whole().upper() : sup);
+		}
+
+		template <typename T, typename Trait>
 		constexpr ::std::pair<T, T>
 		interval_operator_mul_impl2(const T &inf1, const T &sup1, const T &x)
 		{
@@ -625,14 +857,14 @@ namespace cti{
 
 			using ::sprout::fabs;
 
-			double inf = 0.0, sup = 0.0;
+			T inf = 0.0, sup = 0.0;
 
 			if(x > 0.0){
-				inf = trait<T>::mul_down(x, inf1);
-				sup = trait<T>::mul_up(x, sup1);
+				inf = Trait::mul_down(x, inf1);
+				sup = Trait::mul_up(x, sup1);
 			}else if(x < 0.0){
-				inf = trait<T>::mul_down(x, sup1);
-				sup = trait<T>::mul_up(x, inf1);
+				inf = Trait::mul_down(x, sup1);
+				sup = Trait::mul_up(x, inf1);
 			}else{
 				if(fabs(inf1) == infinity || fabs(sup1) == infinity){
 					inf = trait<T>::whole().lower();
@@ -643,33 +875,33 @@ namespace cti{
 			return ::std::make_pair(inf, sup);
 		}
 
-		template <typename T>
+		template <typename T, typename Trait>
 		constexpr ::std::pair<T, T>
 		interval_operator_div_impl1(const T &inf1, const T &sup1, const T &inf2, const T &sup2)
 		{
-			double inf = 0.0, sup = 0.0;
+			T inf = 0.0, sup = 0.0;
 
 			if(inf2 > 0.0){
 				if(inf1 >= 0.0){
-					inf = trait<T>::div_down(inf1, sup2);
-					sup = trait<T>::div_up(sup1, inf2);
+					inf = Trait::div_down(inf1, sup2);
+					sup = Trait::div_up(sup1, inf2);
 				}else if(sup1 <= 0.0){
-					inf = trait<T>::div_down(inf1, inf2);
-					sup = trait<T>::div_up(sup1, sup2);
+					inf = Trait::div_down(inf1, inf2);
+					sup = Trait::div_up(sup1, sup2);
 				}else{
-					inf = trait<T>::div_down(inf1, inf2);
-					sup = trait<T>::div_up(sup1, inf2);
+					inf = Trait::div_down(inf1, inf2);
+					sup = Trait::div_up(sup1, inf2);
 				}
 			}else if(sup2 < 0.0){
 				if(inf1 >= 0.0){
-					inf = trait<T>::div_down(sup1, sup2);
-					sup = trait<T>::div_up(inf1, inf2);
+					inf = Trait::div_down(sup1, sup2);
+					sup = Trait::div_up(inf1, inf2);
 				}else if(sup1 <= 0.0){
-					inf = trait<T>::div_down(sup1, inf2);
-					sup = trait<T>::div_up(inf1, sup2);
+					inf = Trait::div_down(sup1, inf2);
+					sup = Trait::div_up(inf1, sup2);
 				}else{
-					inf = trait<T>::div_down(sup1, sup2);
-					sup = trait<T>::div_up(inf1, sup2);
+					inf = Trait::div_down(sup1, sup2);
+					sup = Trait::div_up(inf1, sup2);
 				}
 			}else{
 				throw ::std::domain_error("cti::interval: division by 0");
@@ -678,18 +910,18 @@ namespace cti{
 			return ::std::make_pair(inf, sup);
 		}
 
-		template <typename T>
+		template <typename T, typename Trait>
 		constexpr ::std::pair<T, T>
 		interval_operator_div_impl2(const T &inf1, const T &sup1, const T &y)
 		{
-			double inf = 0.0, sup = 0.0;
+			T inf = 0.0, sup = 0.0;
 
 			if(y > 0.0){
-				inf = trait<T>::div_down(inf1, y);
-				sup = trait<T>::div_up(sup1, y);
+				inf = Trait::div_down(inf1, y);
+				sup = Trait::div_up(sup1, y);
 			}else if(y < 0.0){
-				inf = trait<T>::div_down(sup1, y);
-				sup = trait<T>::div_up(inf1, y);
+				inf = Trait::div_down(sup1, y);
+				sup = Trait::div_up(inf1, y);
 			}else{
 				throw ::std::domain_error("cti::interval: division by 0");
 			}
@@ -697,19 +929,19 @@ namespace cti{
 			return ::std::make_pair(inf, sup);
 		}
 
-		template <typename T>
+		template <typename T, typename Trait>
 		constexpr ::std::pair<T, T>
 		interval_operator_div_impl3(const T &x, const T &inf2, const T &sup2)
 		{
-			double inf = 0.0, sup = 0.0;
+			T inf = 0.0, sup = 0.0;
 
 			if(inf2 > 0.0 || sup2 < 0.0){
 				if(x >= 0.0){
-					inf = trait<T>::div_down(x, sup2);
-					sup = trait<T>::div_up(x, inf2);
+					inf = Trait::div_down(x, sup2);
+					sup = Trait::div_up(x, inf2);
 				}else{
-					inf = trait<T>::div_down(x, inf2);
-					sup = trait<T>::div_up(x, sup2);
+					inf = Trait::div_down(x, inf2);
+					sup = Trait::div_up(x, sup2);
 				}
 			}else{
 				throw ::std::domain_error("cti::interval: division by 0");
@@ -717,16 +949,186 @@ namespace cti{
 
 			return ::std::make_pair(inf, sup);
 		}
+
+		template <typename T, typename Trait = trait<T>>
+		constexpr ::std::pair<T, T>
+		interval_sqrt_impl(const T &inf, const T &sup)
+		{
+			constexpr auto infinity = ::std::numeric_limits<T>::infinity();
+
+			if(inf < 0.0)
+				throw ::std::domain_error("cti::sqrt: sqrt of negative value");
+
+			return ::std::make_pair(
+				inf == infinity ? inf : Trait::sqrt_down(inf),
+				sup == infinity ? sup : Trait::sqrt_up(sup));
+		}
+
+		template <typename T>
+		constexpr ::std::pair<T, T>
+		interval_abs_impl(const T &inf, const T &sup)
+		{
+			if(inf >= 0.0)
+				return ::std::make_pair(inf, sup);
+			if(sup <= 0.0)
+				return ::std::make_pair(-sup, -inf);
+
+			return ::std::make_pair(T(0.0), interval_operator_max(-inf, sup));
+		}
+
+		// x^n for x >= 0 by repeated squaring, rounded down or up
+		template <typename T, typename Trait = trait<T>>
+		constexpr T interval_pow_down(T x, unsigned n)
+		{
+			T result = 1.0;
+
+			while(n != 0){
+				if(n & 1)
+					result = Trait::mul_down(result, x);
+				n >>= 1;
+				if(n != 0)
+					x = Trait::mul_down(x, x);
+			}
+
+			return result;
+		}
+
+		template <typename T, typename Trait = trait<T>>
+		constexpr T interval_pow_up(T x, unsigned n)
+		{
+			T result = 1.0;
+
+			while(n != 0){
+				if(n & 1)
+					result = Trait::mul_up(result, x);
+				n >>= 1;
+				if(n != 0)
+					x = Trait::mul_up(x, x);
+			}
+
+			return result;
+		}
+
+		// x^n for an integer n.  an even power is taken on |x|, so the lower
+		// bound is 0 when x contains 0; an odd power is increasing.
+		template <typename T, typename Trait = trait<T>>
+		constexpr ::std::pair<T, T>
+		interval_pow_int_impl(const T &inf, const T &sup, int n)
+		{
+			if(n < 0){
+				auto result = interval_pow_int_impl<T, Trait>(inf, sup, -n);
+				return interval_operator_div_impl3<T, Trait>(T(1.0), ::std::get<0>(result), ::std::get<1>(result));
+			}
+
+			unsigned m = static_cast<unsigned>(n);
+
+			if(m % 2 == 0){
+				auto a = interval_abs_impl(inf, sup);
+				return ::std::make_pair(
+					interval_pow_down<T, Trait>(::std::get<0>(a), m),
+					interval_pow_up<T, Trait>(::std::get<1>(a), m));
+			}
+
+			return ::std::make_pair(
+				inf < 0.0 ? -interval_pow_up<T, Trait>(-inf, m) : interval_pow_down<T, Trait>(inf, m),
+				sup < 0.0 ? -interval_pow_down<T, Trait>(-sup, m) : interval_pow_up<T, Trait>(sup, m));
+		}
+
+		// a point of [inf, sup] close to its midpoint.  the halves are
+		// exact above the subnormal range and the rounded sum is clamped
+		// into the interval.  a half-line gives its finite extreme and the
+		// whole line gives 0.
+		template <typename T, typename Trait = trait<T>>
+		constexpr T interval_mid_impl(const T &inf, const T &sup)
+		{
+			constexpr T infinity = ::std::numeric_limits<T>::infinity();
+
+			if(inf == sup)
+				return inf;
+			if(inf == -infinity)
+				return sup == infinity ? T(0.0) : -::std::numeric_limits<T>::max();
+			if(sup == infinity)
+				return ::std::numeric_limits<T>::max();
+
+			T m = Trait::add_up(Trait::mul_down(inf, T(0.5)), Trait::mul_down(sup, T(0.5)));
+
+			if(m < inf)
+				return inf;
+			if(m > sup)
+				return sup;
+			return m;
+		}
+
+		// max(mid - inf, sup - mid) rounded up, so that [mid - r, mid + r]
+		// covers [inf, sup].  unbounded intervals are handled up front since
+		// twosum cannot form inf - inf in a constant expression.
+		template <typename T, typename Trait = trait<T>>
+		constexpr T interval_rad_impl(const T &inf, const T &sup)
+		{
+			constexpr T infinity = ::std::numeric_limits<T>::infinity();
+
+			if(inf == -infinity || sup == infinity)
+				return infinity;
+
+			T m = interval_mid_impl<T, Trait>(inf, sup);
+			return interval_operator_max(Trait::sub_up(m, inf), Trait::sub_up(sup, m));
+		}
+
+		template <typename T, typename Trait = trait<T>>
+		constexpr T interval_width_impl(const T &inf, const T &sup)
+		{
+			constexpr T infinity = ::std::numeric_limits<T>::infinity();
+
+			if(inf == -infinity || sup == infinity)
+				return infinity;
+
+			return Trait::sub_up(sup, inf);
+		}
+
+		template <typename T>
+		constexpr ::std::pair<T, T>
+		interval_intersect_impl(const T &inf1, const T &sup1, const T &inf2, const T &sup2)
+		{
+			T inf = interval_operator_max(inf1, inf2);
+			T sup = interval_operator_min(sup1, sup2);
+
+			if(sup < inf)
+				throw ::std::domain_error("cti::intersect: empty intersection");
+
+			return ::std::make_pair(inf, sup);
+		}
 	}
 
 	template <typename Inf, typename Sup>
 	struct is_interval<interval<Inf, Sup>> : ::std::true_type{
 	};
 
+	// algorithms for the product of two intervals, for code that takes the
+	// multiplication as a policy.  mul_by_cases branches on the signs of the
+	// operands, mul_by_minmax does not and suits unpredictable signs and
+	// vectorization.
+	struct mul_by_cases{
+		template <typename T, typename Trait = trait<T>>
+		static constexpr ::std::pair<T, T>
+		apply(const T &inf1, const T &sup1, const T &inf2, const T &sup2)
+		{
+			return detail::interval_operator_mul_impl1<T, Trait>(inf1, sup1, inf2, sup2);
+		}
+	};
+
+	struct mul_by_minmax{
+		template <typename T, typename Trait = trait<T>>
+		static constexpr ::std::pair<T, T>
+		apply(const T &inf1, const T &sup1, const T &inf2, const T &sup2)
+		{
+			return detail::interval_operator_mul_impl1_minmax<T, Trait>(inf1, sup1, inf2, sup2);
+		}
+	};
+
 	template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
 	constexpr bool overlap(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
 	{
-		using common_t = ::std::common_type_t<typename Inf1::type, typename Inf2::type>;
+		using common_t = ::std::common_type_t<typename Inf1::value_type, typename Inf2::value_type>;
 
 		auto tmp1 = static_cast<common_t>(Inf1::value);
 
@@ -740,11 +1142,233 @@ namespace cti{
 
 		return tmp1 <= tmp2;
 	}
+
+	namespace detail{
+		// the relation that holds exactly when Relation does not
+		template <typename Relation>
+		struct negated_relation;
+
+		template <>
+		struct negated_relation<::std::less<>>{
+			using type = ::std::greater_equal<>;
+		};
+
+		template <>
+		struct negated_relation<::std::less_equal<>>{
+			using type = ::std::greater<>;
+		};
+
+		template <>
+		struct negated_relation<::std::greater<>>{
+			using type = ::std::less_equal<>;
+		};
+
+		template <>
+		struct negated_relation<::std::greater_equal<>>{
+			using type = ::std::less<>;
+		};
+
+		template <>
+		struct negated_relation<::std::equal_to<>>{
+			using type = ::std::not_equal_to<>;
+		};
+
+		template <>
+		struct negated_relation<::std::not_equal_to<>>{
+			using type = ::std::equal_to<>;
+		};
+	}
+
+	// a comparison of intervals or encoded scalars as a type, for tag
+	// dispatch in runtime code.  Relation is one of std::less<>,
+	// std::less_equal<>, std::greater<>, std::greater_equal<>,
+	// std::equal_to<> and std::not_equal_to<>.  certainly holds when the
+	// relation holds for every pair of points of x and y, which is the
+	// meaning of the operators of cti::interval; possibly holds when it
+	// holds for at least one pair.
+	//
+	//     void scale(std::true_type, ...);     // x > 0, no sign checks
+	//     void scale(std::false_type, ...);    // any x
+	//     scale(cti::certainly<std::greater<>>(x, CTI_DOUBLE(0.0){}), ...);
+	template <typename Relation, typename X, typename Y>
+	constexpr auto certainly(X, Y)
+	{
+		return ::std::integral_constant<bool, Relation{}(X{}, Y{})>{};
+	}
+
+	template <typename Relation, typename X, typename Y>
+	constexpr auto possibly(X, Y)
+	{
+		using negated = typename detail::negated_relation<Relation>::type;
+
+		return ::std::integral_constant<bool, !negated{}(X{}, Y{})>{};
+	}
+
+	template <typename Inf, typename Sup>
+	constexpr auto sqrt(interval<Inf, Sup>)
+	{
+		using value_type = typename Inf::value_type;
+
+		constexpr auto result = detail::interval_sqrt_impl<value_type>(Inf::value, Sup::value);
+
+		constexpr auto inf = ::std::get<0>(result);
+		constexpr auto sup = ::std::get<1>(result);
+
+		return detail::bound_interval_t<value_type,
+			detail::bound<value_type>::leading(inf), detail::bound<value_type>::trailing(inf),
+			detail::bound<value_type>::leading(sup), detail::bound<value_type>::trailing(sup)>{};
+	}
+
+	template <typename Inf, typename Sup>
+	constexpr auto abs(interval<Inf, Sup>)
+	{
+		using value_type = typename Inf::value_type;
+
+		constexpr auto result = detail::interval_abs_impl<value_type>(Inf::value, Sup::value);
+
+		constexpr auto inf = ::std::get<0>(result);
+		constexpr auto sup = ::std::get<1>(result);
+
+		return detail::bound_interval_t<value_type,
+			detail::bound<value_type>::leading(inf), detail::bound<value_type>::trailing(inf),
+			detail::bound<value_type>::leading(sup), detail::bound<value_type>::trailing(sup)>{};
+	}
+
+	template <int N, typename Inf, typename Sup>
+	constexpr auto pow(interval<Inf, Sup>)
+	{
+		using value_type = typename Inf::value_type;
+
+		constexpr auto result = detail::interval_pow_int_impl<value_type>(Inf::value, Sup::value, N);
+
+		constexpr auto inf = ::std::get<0>(result);
+		constexpr auto sup = ::std::get<1>(result);
+
+		return detail::bound_interval_t<value_type,
+			detail::bound<value_type>::leading(inf), detail::bound<value_type>::trailing(inf),
+			detail::bound<value_type>::leading(sup), detail::bound<value_type>::trailing(sup)>{};
+	}
+
+	template <typename Inf, typename Sup>
+	constexpr auto square(interval<Inf, Sup> x)
+	{
+		return pow<2>(x);
+	}
+
+	// the smallest interval containing x and y
+	template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
+	constexpr auto hull(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
+	{
+		using common_t = ::std::common_type_t<typename Inf1::value_type, typename Inf2::value_type>;
+
+		constexpr auto inf = detail::interval_operator_min(static_cast<common_t>(Inf1::value), static_cast<common_t>(Inf2::value));
+		constexpr auto sup = detail::interval_operator_max(static_cast<common_t>(Sup1::value), static_cast<common_t>(Sup2::value));
+
+		return detail::bound_interval_t<common_t,
+			detail::bound<common_t>::leading(inf), detail::bound<common_t>::trailing(inf),
+			detail::bound<common_t>::leading(sup), detail::bound<common_t>::trailing(sup)>{};
+	}
+
+	// the common part of x and y, which must overlap
+	template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
+	constexpr auto intersect(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
+	{
+		using common_t = ::std::common_type_t<typename Inf1::value_type, typename Inf2::value_type>;
+
+		constexpr auto result = detail::interval_intersect_impl(
+			static_cast<common_t>(Inf1::value), static_cast<common_t>(Sup1::value),
+			static_cast<common_t>(Inf2::value), static_cast<common_t>(Sup2::value));
+
+		constexpr auto inf = ::std::get<0>(result);
+		constexpr auto sup = ::std::get<1>(result);
+
+		return detail::bound_interval_t<common_t,
+			detail::bound<common_t>::leading(inf), detail::bound<common_t>::trailing(inf),
+			detail::bound<common_t>::leading(sup), detail::bound<common_t>::trailing(sup)>{};
+	}
+
+	// mid, rad and width are encoded scalars like CTI_DOUBLE(x), so they
+	// can be used as operands of the interval operators.  x is contained
+	// in [mid(x) - rad(x), mid(x) + rad(x)], and rad and width are upper
+	// bounds.
+	template <typename Inf, typename Sup>
+	constexpr auto mid(interval<Inf, Sup>)
+	{
+		using value_type = typename Inf::value_type;
+
+		constexpr auto m = detail::interval_mid_impl<value_type>(Inf::value, Sup::value);
+
+		return detail::bound_t<value_type, detail::bound<value_type>::leading(m), detail::bound<value_type>::trailing(m)>{};
+	}
+
+	template <typename Inf, typename Sup>
+	constexpr auto rad(interval<Inf, Sup>)
+	{
+		using value_type = typename Inf::value_type;
+
+		constexpr auto r = detail::interval_rad_impl<value_type>(Inf::value, Sup::value);
+
+		return detail::bound_t<value_type, detail::bound<value_type>::leading(r), detail::bound<value_type>::trailing(r)>{};
+	}
+
+	template <typename Inf, typename Sup>
+	constexpr auto width(interval<Inf, Sup>)
+	{
+		using value_type = typename Inf::value_type;
+
+		constexpr auto w = detail::interval_width_impl<value_type>(Inf::value, Sup::value);
+
+		return detail::bound_t<value_type, detail::bound<value_type>::leading(w), detail::bound<value_type>::trailing(w)>{};
+	}
+
+	// x is contained in y
+	template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
+	constexpr bool subset(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
+	{
+		using common_t = ::std::common_type_t<typename Inf1::value_type, typename Inf2::value_type>;
+
+		return static_cast<common_t>(Inf2::value) <= static_cast<common_t>(Inf1::value)
+			&& static_cast<common_t>(Sup1::value) <= static_cast<common_t>(Sup2::value);
+	}
+
+	// x is a point of y
+	template <
+		typename T,
+		typename Inf,
+		typename Sup,
+		::std::enable_if_t<
+			::std::is_convertible<typename T::value_type, typename Inf::value_type>{}
+			&& !is_interval<T>{}
+			&& detail::has_static_value<T>{}
+		>* = nullptr
+	>
+	constexpr bool in(T, interval<Inf, Sup>)
+	{
+		using common_t = ::std::common_type_t<typename T::value_type, typename Inf::value_type>;
+
+		return static_cast<common_t>(Inf::value) <= static_cast<common_t>(T::value)
+			&& static_cast<common_t>(T::value) <= static_cast<common_t>(Sup::value);
+	}
+
+	template <typename Inf, typename Sup>
+	constexpr bool in(const typename Inf::value_type &x, interval<Inf, Sup>)
+	{
+		return Inf::value <= x && x <= Sup::value;
+	}
+
+	// the halves [inf, mid(x)] and [mid(x), sup] of x
+	template <typename Inf, typename Sup>
+	constexpr auto bisect(interval<Inf, Sup> x)
+	{
+		using m = decltype(mid(x));
+
+		return ::std::make_pair(interval<Inf, m>{}, interval<m, Sup>{});
+	}
 }
 
 #if !defined(CTI_I) && !defined(CTI_I_1) && !defined(CTI_I_2)
-# define CTI_I_1(x) ::cti::interval<BCL_DOUBLE_T(x), BCL_DOUBLE_T(x)>
-# define CTI_I_2(x, y) ::cti::interval<BCL_DOUBLE_T(x), BCL_DOUBLE_T(y)>
+# define CTI_I_1(x) ::cti::interval<CTI_DOUBLE(x), CTI_DOUBLE(x)>
+# define CTI_I_2(x, y) ::cti::interval<CTI_DOUBLE(x), CTI_DOUBLE(y)>
 
 # if defined(_MSC_VER)
 #  define CTI_I(...) BOOST_PP_CAT(BOOST_PP_OVERLOAD(CTI_I_,__VA_ARGS__)(__VA_ARGS__),BOOST_PP_EMPTY())
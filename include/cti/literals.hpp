@@ -1,30 +1,59 @@
 #pragma once
 
+#include <type_traits>
+#include <utility>
+#include <tuple>
+
 #include <sprout/string.hpp>
 
-#include <bcl/double.hpp>
 #include <bcl/string.hpp>
 
+#include <cti/decimal.hpp>
+#include <cti/double.hpp>
 #include <cti/interval.hpp>
 
 namespace cti{
+	namespace detail{
+		template <char ... Chars>
+		constexpr bool literal_hex()
+		{
+			constexpr char str[] = {Chars..., '\0', '\0'};
+			return str[0] == '0' && (str[1] == 'x' || str[1] == 'X');
+		}
+
+		template <char ... Chars>
+		constexpr ::std::pair<double, double> literal_bounds(::std::false_type)
+		{
+			constexpr char str[] = {Chars...};
+			return decimal_bounds<sizeof...(Chars)>(str);
+		}
+
+		// hexadecimal literals are left to bcl
+		template <char ... Chars>
+		constexpr ::std::pair<double, double> literal_bounds(::std::true_type)
+		{
+			constexpr auto str = ::sprout::make_string(Chars...);
+			return {::bcl::stod(str, nullptr, -1), ::bcl::stod(str, nullptr, 1)};
+		}
+	}
+
 	namespace literals{
 		inline namespace double_interval{
+			// the tightest interval containing the decimal literal, e.g.
+			// 3.14159265358979323846264338327950288_di
 			template <char ... Chars>
 			constexpr auto operator "" _di()
 			{
-				constexpr auto str = ::sprout::make_string(Chars...);
-				constexpr double d1 = ::bcl::stod(str, nullptr, -1);
-				constexpr double d2 = ::bcl::stod(str, nullptr, 1);
-				constexpr auto e1 = ::bcl::encode(d1);
-				constexpr auto e2 = ::bcl::encode(d2);
+				constexpr auto bounds = ::cti::detail::literal_bounds<Chars...>(
+					::std::integral_constant<bool, ::cti::detail::literal_hex<Chars...>()>{});
+				constexpr auto e1 = ::cti::detail::double_to_bits(::std::get<0>(bounds));
+				constexpr auto e2 = ::cti::detail::double_to_bits(::std::get<1>(bounds));
 
-				using inf_type = BCL_DOUBLE(e1);
-				using sup_type = BCL_DOUBLE(e2);
+				using inf_type = ::cti::double_<e1>;
+				using sup_type = ::cti::double_<e2>;
 
 				return ::cti::interval<inf_type, sup_type>{};
 			}
 		}
 	}
 }
-
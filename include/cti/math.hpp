@@ -0,0 +1,607 @@
+#pragma once
+
+#include <utility>
+#include <tuple>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include <sprout/math/fabs.hpp>
+#include <sprout/math/ldexp.hpp>
+
+#include <bcl/double.hpp>
+
+#include <cti/interval.hpp>
+#include <cti/rinterval.hpp>
+#include <cti/rdouble.hpp>
+
+namespace cti{
+	// elementary functions of cti::interval evaluated at compile time
+	//
+	// each function is evaluated with interval arithmetic on trait<double>:
+	// argument reduction, a truncated series and an interval bounding the
+	// truncation error.  the result is encoded into a new interval<...>
+	// enclosing the range of the function over the argument.
+	//
+	//     constexpr auto y = cti::exp(x) * cti::sin(x);
+	//
+	// the same functions are provided for rinterval<double, Trait>, where
+	// the arithmetic uses Trait instead.
+
+	namespace detail{
+		// interval value used while evaluating a function
+		struct math_interval{
+			double inf;
+			double sup;
+		};
+
+		constexpr math_interval math_point(double x)
+		{
+			return {x, x};
+		}
+
+		template <typename Trait>
+		constexpr math_interval math_add(const math_interval &x, const math_interval &y)
+		{
+			auto result = interval_operator_add_impl1<double, Trait>(x.inf, x.sup, y.inf, y.sup);
+			return {::std::get<0>(result), ::std::get<1>(result)};
+		}
+
+		template <typename Trait>
+		constexpr math_interval math_sub(const math_interval &x, const math_interval &y)
+		{
+			auto result = interval_operator_sub_impl1<double, Trait>(x.inf, x.sup, y.inf, y.sup);
+			return {::std::get<0>(result), ::std::get<1>(result)};
+		}
+
+		constexpr math_interval math_neg(const math_interval &x)
+		{
+			return {-x.sup, -x.inf};
+		}
+
+		template <typename Trait>
+		constexpr math_interval math_mul(const math_interval &x, const math_interval &y)
+		{
+			auto result = interval_operator_mul_impl1<double, Trait>(x.inf, x.sup, y.inf, y.sup);
+			return {::std::get<0>(result), ::std::get<1>(result)};
+		}
+
+		template <typename Trait>
+		constexpr math_interval math_div(const math_interval &x, const math_interval &y)
+		{
+			auto result = interval_operator_div_impl1<double, Trait>(x.inf, x.sup, y.inf, y.sup);
+			return {::std::get<0>(result), ::std::get<1>(result)};
+		}
+
+		// [-|x|, |x|], used for the truncation error of a series
+		constexpr math_interval math_error(const math_interval &x)
+		{
+			double m = interval_operator_max(::sprout::fabs(x.inf), ::sprout::fabs(x.sup));
+			return {-m, m};
+		}
+
+		// [-e, e] where e >= |x|^n / n!
+		template <typename Trait>
+		constexpr math_interval math_taylor_error(const math_interval &x, int n)
+		{
+			math_interval term = math_point(1.0);
+			for(int j = 1; j <= n; ++j)
+				term = math_div<Trait>(math_mul<Trait>(term, x), math_point(j));
+			return math_error(term);
+		}
+
+		constexpr double math_floor(double x)
+		{
+			double t = static_cast<double>(static_cast<long long>(x));
+			return t > x ? t - 1.0 : t;
+		}
+
+		constexpr double math_ceil(double x)
+		{
+			double t = static_cast<double>(static_cast<long long>(x));
+			return t < x ? t + 1.0 : t;
+		}
+
+		constexpr double math_round(double x)
+		{
+			return static_cast<double>(static_cast<long long>(x < 0.0 ? x - 0.5 : x + 0.5));
+		}
+
+		// the doubles below and above pi
+		constexpr math_interval math_pi()
+		{
+			return {::sprout::ldexp(7074237752028440.0, -51), ::sprout::ldexp(7074237752028441.0, -51)};
+		}
+
+		// pi / 2 = pi_2_hi + pi_2_mid + pi_2_lo where the first two parts
+		// have 23 bits, so that k pi_2_hi and k pi_2_mid are exact for
+		// |k| < 2^30
+		constexpr double math_pi_2_hi()
+		{
+			return ::sprout::ldexp(6588397.0, -22);
+		}
+
+		constexpr double math_pi_2_mid()
+		{
+			return ::sprout::ldexp(5312692.0, -46);
+		}
+
+		constexpr math_interval math_pi_2_lo()
+		{
+			return {::sprout::ldexp(6833020653556080.0, -100), ::sprout::ldexp(6833020653556081.0, -100)};
+		}
+
+		// log(2) = ln2_hi + ln2_lo where ln2_hi has 32 bits, so that k ln2_hi
+		// is exact for |k| < 2^21
+		constexpr double math_ln2_hi()
+		{
+			return ::sprout::ldexp(2977044471.0, -32);
+		}
+
+		constexpr math_interval math_ln2_lo()
+		{
+			return {::sprout::ldexp(7382048951581814.0, -85), ::sprout::ldexp(7382048951581815.0, -85)};
+		}
+
+		template <typename Trait>
+		constexpr math_interval math_exp_point(double x)
+		{
+			constexpr double max = ::std::numeric_limits<double>::max();
+			constexpr double infinity = ::std::numeric_limits<double>::infinity();
+			constexpr double denorm_min = ::std::numeric_limits<double>::denorm_min();
+
+			if(x != x)
+				throw ::std::domain_error("cti::exp: argument is nan");
+
+			// log(max) = 709.7827..., log(denorm_min / 2) = -745.13...; the
+			// arguments in between round to k <= 1024 below
+			if(x > 709.79)
+				return {max, infinity};
+			if(x < -745.2)
+				return {0.0, denorm_min};
+
+			// exp(x) = 2^k exp(r), |r| <= log(2) / 2 (plus rounding)
+			double k = math_round(x / 0.6931471805599453);
+			math_interval r = math_sub<Trait>(
+				math_sub<Trait>(math_point(x), math_point(k * math_ln2_hi())),
+				math_mul<Trait>(math_point(k), math_ln2_lo()));
+
+			// taylor series in horner form; the remainder is bounded by
+			// e^|r| |r|^21 / 21! and e^|r| < 2
+			math_interval sum = math_point(1.0);
+			for(int j = 20; j >= 1; --j)
+				sum = math_add<Trait>(math_point(1.0), math_div<Trait>(math_mul<Trait>(r, sum), math_point(j)));
+			sum = math_add<Trait>(sum, math_mul<Trait>(math_point(2.0), math_taylor_error<Trait>(r, 21)));
+
+			// 2^k in two steps, each factor is a normal number
+			int k1 = static_cast<int>(k) / 2;
+			int k2 = static_cast<int>(k) - k1;
+			sum = math_mul<Trait>(sum, math_point(::sprout::ldexp(1.0, k1)));
+
+			if(k2 == 512){
+				// k = 1023 or 1024 (k1 = 511 or 512): the product by 2^512
+				// may overflow, which is not a constant expression, so the
+				// last doubling is done here.  it is exact unless it
+				// overflows
+				sum = math_mul<Trait>(sum, math_point(::sprout::ldexp(1.0, k2 - 1)));
+				return {
+					sum.inf > max / 2.0 ? max : sum.inf * 2.0,
+					sum.sup > max / 2.0 ? infinity : sum.sup * 2.0};
+			}
+
+			return math_mul<Trait>(sum, math_point(::sprout::ldexp(1.0, k2)));
+		}
+
+		template <typename Trait>
+		constexpr math_interval math_log_point(double x)
+		{
+			constexpr double max = ::std::numeric_limits<double>::max();
+			constexpr double infinity = ::std::numeric_limits<double>::infinity();
+			constexpr double th = ::sprout::ldexp(1.0, -1022);
+
+			if(x != x)
+				throw ::std::domain_error("cti::log: argument is nan");
+			if(x < 0.0)
+				throw ::std::domain_error("cti::log: log of negative value");
+
+			if(x == 0.0)
+				return {-infinity, -infinity};
+			if(x == infinity)
+				return {max, infinity};
+
+			// x = m 2^k, 1/sqrt(2) < m <= sqrt(2); every scaling is exact
+			double m = x;
+			double k = 0.0;
+			if(m < th){
+				m *= ::sprout::ldexp(1.0, 64);
+				k -= 64.0;
+			}
+			while(m >= ::sprout::ldexp(1.0, 64)){
+				m *= ::sprout::ldexp(1.0, -64);
+				k += 64.0;
+			}
+			while(m >= 2.0){
+				m *= 0.5;
+				k += 1.0;
+			}
+			while(m < 1.0){
+				m *= 2.0;
+				k -= 1.0;
+			}
+			if(m > 1.4142135623730951){
+				m *= 0.5;
+				k += 1.0;
+			}
+
+			// log(m) = 2 atanh(z), z = (m - 1) / (m + 1), |z| < 0.172.
+			// the remainder of the series is bounded by
+			// |z|^29 / 29 / (1 - z^2) < 2 |z|^29 / 29
+			math_interval z = math_div<Trait>(
+				math_sub<Trait>(math_point(m), math_point(1.0)),
+				math_add<Trait>(math_point(m), math_point(1.0)));
+			math_interval z2 = math_mul<Trait>(z, z);
+			math_interval sum = math_div<Trait>(math_point(1.0), math_point(27.0));
+			math_interval power = z;
+			for(int j = 12; j >= 0; --j){
+				sum = math_add<Trait>(math_div<Trait>(math_point(1.0), math_point(2 * j + 1)), math_mul<Trait>(z2, sum));
+				power = math_mul<Trait>(power, z2);
+			}
+			power = math_mul<Trait>(power, z2);
+			sum = math_mul<Trait>(z, sum);
+			sum = math_add<Trait>(sum, math_mul<Trait>(math_point(2.0), math_error(math_div<Trait>(power, math_point(29.0)))));
+
+			math_interval k_ln2 = math_add<Trait>(math_point(k * math_ln2_hi()), math_mul<Trait>(math_point(k), math_ln2_lo()));
+			return math_add<Trait>(k_ln2, math_mul<Trait>(math_point(2.0), sum));
+		}
+
+		// atan(x) for 0 <= x <= 1
+		template <typename Trait>
+		constexpr math_interval math_atan_reduced(const math_interval &x)
+		{
+			// atan(x) = 2 atan(y), y = x / (1 + sqrt(1 + x^2)) <= tan(pi / 8)
+			math_interval s = math_add<Trait>(math_point(1.0), math_mul<Trait>(x, x));
+			auto root = interval_sqrt_impl<double, Trait>(s.inf, s.sup);
+			s = {::std::get<0>(root), ::std::get<1>(root)};
+			math_interval y = math_div<Trait>(x, math_add<Trait>(math_point(1.0), s));
+
+			// alternating series in horner form; the remainder is bounded by the first
+			// omitted term |y|^49 / 49
+			math_interval y2 = math_mul<Trait>(y, y);
+			math_interval sum = math_div<Trait>(math_point(-1.0), math_point(47.0));
+			math_interval power = y;
+			for(int j = 22; j >= 0; --j){
+				math_interval c = math_div<Trait>(math_point(j % 2 == 1 ? -1.0 : 1.0), math_point(2 * j + 1));
+				sum = math_add<Trait>(c, math_mul<Trait>(y2, sum));
+				power = math_mul<Trait>(power, y2);
+			}
+			power = math_mul<Trait>(power, y2);
+			sum = math_mul<Trait>(y, sum);
+			sum = math_add<Trait>(sum, math_error(math_div<Trait>(power, math_point(49.0))));
+
+			return math_mul<Trait>(math_point(2.0), sum);
+		}
+
+		template <typename Trait>
+		constexpr math_interval math_atan_point(double x)
+		{
+			constexpr double infinity = ::std::numeric_limits<double>::infinity();
+
+			if(x != x)
+				throw ::std::domain_error("cti::atan: argument is nan");
+
+			math_interval half_pi = math_mul<Trait>(math_pi(), math_point(0.5));
+			double a = ::sprout::fabs(x);
+
+			// atan(a) = pi / 2 - atan(1 / a)
+			math_interval result = half_pi;
+			if(a == infinity)
+				result = half_pi;
+			else if(a > 1.0)
+				result = math_sub<Trait>(half_pi, math_atan_reduced<Trait>(math_div<Trait>(math_point(1.0), math_point(a))));
+			else
+				result = math_atan_reduced<Trait>(math_point(a));
+
+			return x < 0.0 ? math_neg(result) : result;
+		}
+
+		// sin(r) and cos(r) for |r| <= pi / 4 (plus the reduction error),
+		// taylor series in horner form.  the remainders are bounded by |r|^25 / 25! and |r|^26 / 26!
+		template <typename Trait>
+		constexpr math_interval math_sin_reduced(const math_interval &r)
+		{
+			math_interval r2 = math_mul<Trait>(r, r);
+			math_interval sum = math_point(1.0);
+			for(int j = 11; j >= 1; --j)
+				sum = math_sub<Trait>(math_point(1.0), math_div<Trait>(math_mul<Trait>(r2, sum), math_point((2 * j) * (2 * j + 1))));
+
+			return math_add<Trait>(math_mul<Trait>(r, sum), math_taylor_error<Trait>(r, 25));
+		}
+
+		template <typename Trait>
+		constexpr math_interval math_cos_reduced(const math_interval &r)
+		{
+			math_interval r2 = math_mul<Trait>(r, r);
+			math_interval sum = math_point(1.0);
+			for(int j = 12; j >= 1; --j)
+				sum = math_sub<Trait>(math_point(1.0), math_div<Trait>(math_mul<Trait>(r2, sum), math_point((2 * j - 1) * (2 * j))));
+
+			return math_add<Trait>(sum, math_taylor_error<Trait>(r, 26));
+		}
+
+		// bound of the arguments reduced by pi / 2; the range of sin and cos
+		// is [-1, 1] beyond it
+		constexpr double math_trig_limit()
+		{
+			return ::sprout::ldexp(1.0, 30);
+		}
+
+		// sin(x + q pi / 2)
+		template <typename Trait>
+		constexpr math_interval math_sin_point(double x, int q)
+		{
+			if(x != x)
+				throw ::std::domain_error("cti::sin: argument is nan");
+
+			if(::sprout::fabs(x) > math_trig_limit())
+				return {-1.0, 1.0};
+
+			// x = k pi / 2 + r
+			double k = math_round(x / 1.5707963267948966);
+			math_interval r = math_sub<Trait>(
+				math_sub<Trait>(
+					math_sub<Trait>(math_point(x), math_point(k * math_pi_2_hi())),
+					math_point(k * math_pi_2_mid())),
+				math_mul<Trait>(math_point(k), math_pi_2_lo()));
+
+			long long quadrant = (static_cast<long long>(k) + q) % 4;
+			if(quadrant < 0)
+				quadrant += 4;
+
+			math_interval result = math_point(0.0);
+			switch(quadrant){
+			case 0:
+				result = math_sin_reduced<Trait>(r);
+				break;
+			case 1:
+				result = math_cos_reduced<Trait>(r);
+				break;
+			case 2:
+				result = math_neg(math_sin_reduced<Trait>(r));
+				break;
+			default:
+				result = math_neg(math_cos_reduced<Trait>(r));
+				break;
+			}
+
+			return {interval_operator_max(result.inf, -1.0), interval_operator_min(result.sup, 1.0)};
+		}
+
+		// whether [inf, sup] may contain c + period * n for some integer n
+		template <typename Trait>
+		constexpr bool math_may_contain(double inf, double sup, const math_interval &c, const math_interval &period)
+		{
+			math_interval t = math_div<Trait>(math_sub<Trait>({inf, sup}, c), period);
+			return math_floor(t.sup) >= math_ceil(t.inf);
+		}
+
+		// range of sin(x + q pi / 2) over [inf, sup]
+		template <typename Trait>
+		constexpr ::std::pair<double, double> interval_sin_impl(double inf, double sup, int q)
+		{
+			if(inf != inf || sup != sup)
+				throw ::std::domain_error("cti::sin: argument is nan");
+
+			if(inf < -math_trig_limit() || sup > math_trig_limit())
+				return {-1.0, 1.0};
+
+			// the maxima are at (1 - q) pi / 2 + 2 pi n, the minima at
+			// (-1 - q) pi / 2 + 2 pi n; elsewhere the extrema are at the ends
+			math_interval half_pi = math_mul<Trait>(math_pi(), math_point(0.5));
+			math_interval two_pi = math_mul<Trait>(math_pi(), math_point(2.0));
+
+			math_interval lower = math_sin_point<Trait>(inf, q), upper = math_sin_point<Trait>(sup, q);
+
+			double result_sup = math_may_contain<Trait>(inf, sup, math_mul<Trait>(math_point(1 - q), half_pi), two_pi)
+				? 1.0 : interval_operator_max(lower.sup, upper.sup);
+			double result_inf = math_may_contain<Trait>(inf, sup, math_mul<Trait>(math_point(-1 - q), half_pi), two_pi)
+				? -1.0 : interval_operator_min(lower.inf, upper.inf);
+
+			return {result_inf, result_sup};
+		}
+
+		template <typename Trait>
+		constexpr math_interval math_tan_point(double x)
+		{
+			constexpr double infinity = ::std::numeric_limits<double>::infinity();
+
+			math_interval c = math_sin_point<Trait>(x, 1);
+			if(c.inf <= 0.0 && c.sup >= 0.0)
+				return {-infinity, infinity};
+
+			return math_div<Trait>(math_sin_point<Trait>(x, 0), c);
+		}
+
+		template <typename Trait>
+		constexpr ::std::pair<double, double> interval_exp_impl(double inf, double sup)
+		{
+			return {math_exp_point<Trait>(inf).inf, math_exp_point<Trait>(sup).sup};
+		}
+
+		template <typename Trait>
+		constexpr ::std::pair<double, double> interval_log_impl(double inf, double sup)
+		{
+			return {math_log_point<Trait>(inf).inf, math_log_point<Trait>(sup).sup};
+		}
+
+		template <typename Trait>
+		constexpr ::std::pair<double, double> interval_atan_impl(double inf, double sup)
+		{
+			return {math_atan_point<Trait>(inf).inf, math_atan_point<Trait>(sup).sup};
+		}
+
+		template <typename Trait>
+		constexpr ::std::pair<double, double> interval_tan_impl(double inf, double sup)
+		{
+			constexpr double infinity = ::std::numeric_limits<double>::infinity();
+
+			if(inf != inf || sup != sup)
+				throw ::std::domain_error("cti::tan: argument is nan");
+
+			// tan is increasing between the poles pi / 2 + pi n
+			math_interval half_pi = math_mul<Trait>(math_pi(), math_point(0.5));
+			if(inf < -math_trig_limit() || sup > math_trig_limit()
+			   || math_may_contain<Trait>(inf, sup, half_pi, math_pi()))
+				return {-infinity, infinity};
+
+			return {math_tan_point<Trait>(inf).inf, math_tan_point<Trait>(sup).sup};
+		}
+
+		// x^y = exp(y log(x)) for x > 0
+		template <typename Trait>
+		constexpr ::std::pair<double, double> interval_pow_impl(double inf1, double sup1, double inf2, double sup2)
+		{
+			if(!(inf1 > 0.0))
+				throw ::std::domain_error("cti::pow: base must be positive");
+
+			math_interval l = {math_log_point<Trait>(inf1).inf, math_log_point<Trait>(sup1).sup};
+			math_interval p = math_mul<Trait>(l, {inf2, sup2});
+
+			return {math_exp_point<Trait>(p.inf).inf, math_exp_point<Trait>(p.sup).sup};
+		}
+	}
+
+	template <typename Inf, typename Sup>
+	constexpr auto exp(interval<Inf, Sup>)
+	{
+		constexpr auto result = detail::interval_exp_impl<trait<double>>(Inf::value, Sup::value);
+
+		constexpr auto inf = detail::double_to_bits(::std::get<0>(result));
+		constexpr auto sup = detail::double_to_bits(::std::get<1>(result));
+
+		return interval<double_<inf>, double_<sup>>{};
+	}
+
+	template <typename Inf, typename Sup>
+	constexpr auto log(interval<Inf, Sup>)
+	{
+		constexpr auto result = detail::interval_log_impl<trait<double>>(Inf::value, Sup::value);
+
+		constexpr auto inf = detail::double_to_bits(::std::get<0>(result));
+		constexpr auto sup = detail::double_to_bits(::std::get<1>(result));
+
+		return interval<double_<inf>, double_<sup>>{};
+	}
+
+	template <typename Inf, typename Sup>
+	constexpr auto sin(interval<Inf, Sup>)
+	{
+		constexpr auto result = detail::interval_sin_impl<trait<double>>(Inf::value, Sup::value, 0);
+
+		constexpr auto inf = detail::double_to_bits(::std::get<0>(result));
+		constexpr auto sup = detail::double_to_bits(::std::get<1>(result));
+
+		return interval<double_<inf>, double_<sup>>{};
+	}
+
+	template <typename Inf, typename Sup>
+	constexpr auto cos(interval<Inf, Sup>)
+	{
+		constexpr auto result = detail::interval_sin_impl<trait<double>>(Inf::value, Sup::value, 1);
+
+		constexpr auto inf = detail::double_to_bits(::std::get<0>(result));
+		constexpr auto sup = detail::double_to_bits(::std::get<1>(result));
+
+		return interval<double_<inf>, double_<sup>>{};
+	}
+
+	template <typename Inf, typename Sup>
+	constexpr auto tan(interval<Inf, Sup>)
+	{
+		constexpr auto result = detail::interval_tan_impl<trait<double>>(Inf::value, Sup::value);
+
+		constexpr auto inf = detail::double_to_bits(::std::get<0>(result));
+		constexpr auto sup = detail::double_to_bits(::std::get<1>(result));
+
+		return interval<double_<inf>, double_<sup>>{};
+	}
+
+	template <typename Inf, typename Sup>
+	constexpr auto atan(interval<Inf, Sup>)
+	{
+		constexpr auto result = detail::interval_atan_impl<trait<double>>(Inf::value, Sup::value);
+
+		constexpr auto inf = detail::double_to_bits(::std::get<0>(result));
+		constexpr auto sup = detail::double_to_bits(::std::get<1>(result));
+
+		return interval<double_<inf>, double_<sup>>{};
+	}
+
+	template <typename Inf1, typename Sup1, typename Inf2, typename Sup2>
+	constexpr auto pow(interval<Inf1, Sup1>, interval<Inf2, Sup2>)
+	{
+		constexpr auto result = detail::interval_pow_impl<trait<double>>(Inf1::value, Sup1::value, Inf2::value, Sup2::value);
+
+		constexpr auto inf = detail::double_to_bits(::std::get<0>(result));
+		constexpr auto sup = detail::double_to_bits(::std::get<1>(result));
+
+		return interval<double_<inf>, double_<sup>>{};
+	}
+
+	template <
+		typename Inf, typename Sup, typename T,
+		::std::enable_if_t<::cti::is_encoded_double<T>{}>* = nullptr
+	>
+	constexpr auto pow(interval<Inf, Sup> x, T)
+	{
+		return pow(x, interval<T, T>{});
+	}
+
+	template <typename Trait>
+	constexpr rinterval<double, Trait> exp(const rinterval<double, Trait> &x)
+	{
+		auto result = detail::interval_exp_impl<Trait>(x.lower(), x.upper());
+		return {::std::get<0>(result), ::std::get<1>(result)};
+	}
+
+	template <typename Trait>
+	constexpr rinterval<double, Trait> log(const rinterval<double, Trait> &x)
+	{
+		auto result = detail::interval_log_impl<Trait>(x.lower(), x.upper());
+		return {::std::get<0>(result), ::std::get<1>(result)};
+	}
+
+	template <typename Trait>
+	constexpr rinterval<double, Trait> sin(const rinterval<double, Trait> &x)
+	{
+		auto result = detail::interval_sin_impl<Trait>(x.lower(), x.upper(), 0);
+		return {::std::get<0>(result), ::std::get<1>(result)};
+	}
+
+	template <typename Trait>
+	constexpr rinterval<double, Trait> cos(const rinterval<double, Trait> &x)
+	{
+		auto result = detail::interval_sin_impl<Trait>(x.lower(), x.upper(), 1);
+		return {::std::get<0>(result), ::std::get<1>(result)};
+	}
+
+	template <typename Trait>
+	constexpr rinterval<double, Trait> tan(const rinterval<double, Trait> &x)
+	{
+		auto result = detail::interval_tan_impl<Trait>(x.lower(), x.upper());
+		return {::std::get<0>(result), ::std::get<1>(result)};
+	}
+
+	template <typename Trait>
+	constexpr rinterval<double, Trait> atan(const rinterval<double, Trait> &x)
+	{
+		auto result = detail::interval_atan_impl<Trait>(x.lower(), x.upper());
+		return {::std::get<0>(result), ::std::get<1>(result)};
+	}
+
+	template <typename Trait>
+	constexpr rinterval<double, Trait> pow(const rinterval<double, Trait> &x, const rinterval<double, Trait> &y)
+	{
+		auto result = detail::interval_pow_impl<Trait>(x.lower(), x.upper(), y.lower(), y.upper());
+		return {::std::get<0>(result), ::std::get<1>(result)};
+	}
+}
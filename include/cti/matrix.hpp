@@ -0,0 +1,314 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/rinterval.hpp>
+#include <cti/mrinterval.hpp>
+#include <cti/parallel.hpp>
+
+namespace cti{
+	// runtime interval vector and row-major interval matrix.  the lower and
+	// upper bounds are stored in separate arrays so that the kernels can
+	// stream over them.
+	struct ivector{
+		::std::vector<double> inf;
+		::std::vector<double> sup;
+
+		ivector() = default;
+
+		explicit ivector(::std::size_t n)
+			: inf(n), sup(n)
+		{
+		}
+
+		::std::size_t size() const
+		{
+			return inf.size();
+		}
+
+		rinterval<double> operator[](::std::size_t i) const
+		{
+			return {inf[i], sup[i]};
+		}
+
+		void set(::std::size_t i, const rinterval<double> &x)
+		{
+			inf[i] = x.lower();
+			sup[i] = x.upper();
+		}
+	};
+
+	struct imatrix{
+		::std::size_t rows = 0;
+		::std::size_t cols = 0;
+		::std::vector<double> inf;
+		::std::vector<double> sup;
+
+		imatrix() = default;
+
+		imatrix(::std::size_t rows, ::std::size_t cols)
+			: rows(rows), cols(cols), inf(rows * cols), sup(rows * cols)
+		{
+		}
+
+		rinterval<double> operator()(::std::size_t i, ::std::size_t j) const
+		{
+			return {inf[i * cols + j], sup[i * cols + j]};
+		}
+
+		void set(::std::size_t i, ::std::size_t j, const rinterval<double> &x)
+		{
+			inf[i * cols + j] = x.lower();
+			sup[i * cols + j] = x.upper();
+		}
+	};
+
+	// row-major matrix in midpoint-radius form, the natural input and output
+	// of mul_midrad
+	struct mrmatrix{
+		::std::size_t rows = 0;
+		::std::size_t cols = 0;
+		::std::vector<double> mid;
+		::std::vector<double> rad;
+
+		mrmatrix() = default;
+
+		mrmatrix(::std::size_t rows, ::std::size_t cols)
+			: rows(rows), cols(cols), mid(rows * cols), rad(rows * cols)
+		{
+		}
+
+		mrinterval<double> operator()(::std::size_t i, ::std::size_t j) const
+		{
+			return {mid[i * cols + j], rad[i * cols + j]};
+		}
+
+		void set(::std::size_t i, ::std::size_t j, const mrinterval<double> &x)
+		{
+			mid[i * cols + j] = x.mid();
+			rad[i * cols + j] = x.rad();
+		}
+	};
+
+	namespace detail{
+		// tile sizes of the blocked kernels, in elements
+		constexpr ::std::size_t matrix_block_k = 64;
+		constexpr ::std::size_t matrix_block_j = 256;
+
+		inline void matrix_check_mul(::std::size_t cols_a, ::std::size_t rows_b)
+		{
+			if(cols_a != rows_b)
+				throw ::std::invalid_argument("cti::imatrix: dimensions do not match");
+		}
+
+		// c[i0:i1, :] += a[i0:i1, :] * b, inner products accumulated with
+		// Trait::add_down/add_up
+		template <typename Trait>
+		void matrix_mul_rows(const imatrix &a, const imatrix &b, imatrix &c, ::std::size_t i0, ::std::size_t i1)
+		{
+			::std::size_t n = b.cols, m = a.cols;
+
+			for(::std::size_t kk = 0; kk < m; kk += matrix_block_k){
+				::std::size_t k1 = kk + matrix_block_k < m ? kk + matrix_block_k : m;
+
+				for(::std::size_t jj = 0; jj < n; jj += matrix_block_j){
+					::std::size_t j1 = jj + matrix_block_j < n ? jj + matrix_block_j : n;
+
+					for(::std::size_t i = i0; i < i1; ++i){
+						double *c_inf = &c.inf[i * n], *c_sup = &c.sup[i * n];
+
+						for(::std::size_t k = kk; k < k1; ++k){
+							double a_inf = a.inf[i * m + k], a_sup = a.sup[i * m + k];
+							const double *b_inf = &b.inf[k * n], *b_sup = &b.sup[k * n];
+
+							for(::std::size_t j = jj; j < j1; ++j){
+								auto p = interval_operator_mul_impl1<double, Trait>(a_inf, a_sup, b_inf[j], b_sup[j]);
+								c_inf[j] = Trait::add_down(c_inf[j], ::std::get<0>(p));
+								c_sup[j] = Trait::add_up(c_sup[j], ::std::get<1>(p));
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// midpoint and radius of every entry: x is in <mid, rad>
+	template <typename Trait = trait<double>>
+	mrmatrix to_midrad(const imatrix &x)
+	{
+		mrmatrix y(x.rows, x.cols);
+
+		for(::std::size_t i = 0; i < x.inf.size(); ++i){
+			double m = 0.5 * x.inf[i] + 0.5 * x.sup[i];
+			y.mid[i] = m;
+			y.rad[i] = detail::interval_operator_max(Trait::sub_up(m, x.inf[i]), Trait::sub_up(x.sup[i], m));
+		}
+
+		return y;
+	}
+
+	template <typename Trait = trait<double>>
+	imatrix to_infsup(const mrmatrix &x)
+	{
+		imatrix y(x.rows, x.cols);
+
+		for(::std::size_t i = 0; i < x.mid.size(); ++i){
+			y.inf[i] = Trait::sub_down(x.mid[i], x.rad[i]);
+			y.sup[i] = Trait::add_up(x.mid[i], x.rad[i]);
+		}
+
+		return y;
+	}
+
+	// verified product with inf-sup arithmetic: every multiplication and
+	// addition is rounded outward by Trait.  the rows of the result are
+	// distributed over `threads` threads (0: all hardware threads).
+	template <typename Trait = trait<double>>
+	imatrix mul(const imatrix &a, const imatrix &b, unsigned threads = 0)
+	{
+		detail::matrix_check_mul(a.cols, b.rows);
+
+		imatrix c(a.rows, b.cols);
+
+		detail::parallel_for(a.rows, threads, [&](::std::size_t i0, ::std::size_t i1){
+			detail::matrix_mul_rows<Trait>(a, b, c, i0, i1);
+		});
+
+		return c;
+	}
+
+	// verified product with midpoint-radius arithmetic (rump's method).
+	// the midpoint is an ordinary floating-point product and the radius a
+	// second product of nonnegative matrices, both rounded to nearest and
+	// vectorizable; the rounding errors are covered by the a priori bound
+	// |fl(x^T y) - x^T y| <= gamma_n |x|^T |y| + n eta, gamma_n = n u / (1 - n u).
+	//
+	//     a b in <ma mb, |ma| rb + ra (|mb| + rb)>
+	//
+	// the entries must be finite.
+	template <typename Trait = trait<double>>
+	mrmatrix mul(const mrmatrix &a, const mrmatrix &b, unsigned threads = 0)
+	{
+		detail::matrix_check_mul(a.cols, b.rows);
+
+		constexpr double u = ::std::numeric_limits<double>::epsilon() / 2.0;
+		constexpr double eta = ::std::numeric_limits<double>::denorm_min();
+
+		::std::size_t m = a.cols, n = b.cols;
+
+		// gamma_m and gamma_2m rounded up
+		auto gamma = [](double k){
+			double ku = Trait::mul_up(k, u);
+			return Trait::div_up(ku, Trait::sub_down(1.0, ku));
+		};
+		double gamma1 = gamma(static_cast<double>(m));
+		double gamma2 = gamma(2.0 * static_cast<double>(m));
+
+		// the radius is |ma| (gamma_m |mb| + rb) + ra (|mb| + rb), a product
+		// of nonnegative matrices of inner dimension 2m
+		::std::vector<double> abs_a(a.mid.size()), s(b.mid.size()), t(b.mid.size());
+		for(::std::size_t i = 0; i < a.mid.size(); ++i)
+			abs_a[i] = ::std::fabs(a.mid[i]);
+		for(::std::size_t i = 0; i < b.mid.size(); ++i){
+			double abs_b = ::std::fabs(b.mid[i]);
+			s[i] = Trait::add_up(Trait::mul_up(gamma1, abs_b), b.rad[i]);
+			t[i] = Trait::add_up(abs_b, b.rad[i]);
+		}
+
+		// the midpoint product has m terms and the radius product 2m terms
+		double mid_eta = Trait::mul_up(static_cast<double>(m), eta);
+		double rad_eta = Trait::mul_up(2.0 * static_cast<double>(m), eta);
+		double rad_div = Trait::sub_down(1.0, gamma2);
+
+		mrmatrix c(a.rows, n);
+
+		detail::parallel_for(a.rows, threads, [&](::std::size_t i0, ::std::size_t i1){
+			constexpr ::std::size_t block_i = 16;
+
+			for(::std::size_t ii = i0; ii < i1; ii += block_i){
+				::std::size_t rows = ii + block_i < i1 ? block_i : i1 - ii;
+
+				for(::std::size_t kk = 0; kk < m; kk += detail::matrix_block_k){
+					::std::size_t k1 = kk + detail::matrix_block_k < m ? kk + detail::matrix_block_k : m;
+
+					for(::std::size_t jj = 0; jj < n; jj += detail::matrix_block_j){
+						::std::size_t j1 = jj + detail::matrix_block_j < n ? jj + detail::matrix_block_j : n;
+
+						for(::std::size_t i = ii; i < ii + rows; ++i){
+							double *mc = &c.mid[i * n], *rc = &c.rad[i * n];
+
+							for(::std::size_t k = kk; k < k1; ++k){
+								double ma = a.mid[i * m + k], aa = abs_a[i * m + k], ra = a.rad[i * m + k];
+								const double *mb = &b.mid[k * n], *sb = &s[k * n], *tb = &t[k * n];
+
+								for(::std::size_t j = jj; j < j1; ++j){
+									mc[j] += ma * mb[j];
+									rc[j] += aa * sb[j] + ra * tb[j];
+								}
+							}
+						}
+					}
+				}
+
+				for(::std::size_t i = ii * n; i < (ii + rows) * n; ++i){
+					double r = Trait::div_up(Trait::add_up(c.rad[i], rad_eta), rad_div);
+					c.rad[i] = Trait::add_up(r, mid_eta);
+				}
+			}
+		});
+
+		return c;
+	}
+
+	// mul(mrmatrix, mrmatrix) on inf-sup matrices.  the result is at most
+	// 1.5 times wider than the inf-sup product (plus the rounding error
+	// bound).
+	template <typename Trait = trait<double>>
+	imatrix mul_midrad(const imatrix &a, const imatrix &b, unsigned threads = 0)
+	{
+		detail::matrix_check_mul(a.cols, b.rows);
+
+		return to_infsup<Trait>(mul<Trait>(to_midrad<Trait>(a), to_midrad<Trait>(b), threads));
+	}
+
+	template <typename Trait = trait<double>>
+	ivector mul(const imatrix &a, const ivector &x, unsigned threads = 0)
+	{
+		detail::matrix_check_mul(a.cols, x.size());
+
+		imatrix b(x.size(), 1);
+		b.inf = x.inf;
+		b.sup = x.sup;
+
+		imatrix c = mul<Trait>(a, b, threads);
+
+		ivector y;
+		y.inf = ::std::move(c.inf);
+		y.sup = ::std::move(c.sup);
+		return y;
+	}
+
+	inline imatrix operator*(const imatrix &a, const imatrix &b)
+	{
+		return mul(a, b);
+	}
+
+	inline ivector operator*(const imatrix &a, const ivector &x)
+	{
+		return mul(a, x);
+	}
+
+	inline mrmatrix operator*(const mrmatrix &a, const mrmatrix &b)
+	{
+		return mul(a, b);
+	}
+}
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <tuple>
+#include <type_traits>
+
+#include <kv/interval.hpp>
+
+#include <sprout/math/fabs.hpp>
+#include <sprout/math/ldexp.hpp>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/rinterval.hpp>
+
+namespace cti{
+	// midpoint-radius interval <mid, rad> = [mid - rad, mid + rad]
+	//
+	// the midpoint is rounded to nearest and the radius covers both the
+	// width of the operands and the rounding error of the midpoint, which is
+	// obtained exactly with Trait::twosum and Trait::twoproduct (Rump, Fast
+	// and parallel interval arithmetic, 1999).  addition and multiplication
+	// never go through inf-sup form unless the midpoint or the radius
+	// overflows; division converts to inf-sup and back.  the bounds must be
+	// finite.
+	//
+	//     constexpr cti::mrinterval<double> x = CTI_I(0.1, 0.2){};
+	//     constexpr auto y = x * x + x;
+	//     cti::rinterval<double> z = y.to_rinterval();
+	template <typename T, typename Trait = trait<T>>
+	class mrinterval{
+		T m;
+		T r;
+
+		static constexpr mrinterval from_infsup(const T &inf, const T &sup)
+		{
+			if(inf == -::std::numeric_limits<T>::infinity() || sup == ::std::numeric_limits<T>::infinity())
+				throw ::std::domain_error("cti::mrinterval: unbounded interval");
+
+			T mid = inf * 0.5 + sup * 0.5;
+			return {mid, detail::interval_operator_max(Trait::sub_up(mid, inf), Trait::sub_up(sup, mid))};
+		}
+
+		static constexpr mrinterval from_pair(const ::std::pair<T, T> &x)
+		{
+			return from_infsup(::std::get<0>(x), ::std::get<1>(x));
+		}
+
+		static constexpr bool finite(const T &x)
+		{
+			return x == x && ::sprout::fabs(x) != ::std::numeric_limits<T>::infinity();
+		}
+
+		// rounding error of a product that may have underflowed: twoproduct
+		// is exact only above 2^-969 and otherwise off by at most 5 eta
+		static constexpr T product_error(const ::std::pair<T, T> &p)
+		{
+			constexpr T th = ::sprout::ldexp(1.0, -969);
+			constexpr T eta = ::std::numeric_limits<T>::denorm_min();
+
+			return ::sprout::fabs(::std::get<0>(p)) < th
+				? Trait::add_up(::sprout::fabs(::std::get<1>(p)), 5.0 * eta)
+				: ::sprout::fabs(::std::get<1>(p));
+		}
+
+	public:
+		using value_type = T;
+		using trait_type = Trait;
+
+		constexpr mrinterval()
+			: m(0.0), r(0.0)
+		{
+		}
+
+		constexpr mrinterval(const T &x)
+			: m(x), r(0.0)
+		{
+		}
+
+		constexpr mrinterval(const T &mid, const T &rad)
+			: m(mid), r(rad)
+		{
+		}
+
+		template <typename Inf, typename Sup>
+		constexpr mrinterval(interval<Inf, Sup>)
+			: mrinterval(from_infsup(Inf::value, Sup::value))
+		{
+		}
+
+		template <typename Trait2>
+		constexpr explicit mrinterval(const rinterval<T, Trait2> &x)
+			: mrinterval(from_infsup(x.lower(), x.upper()))
+		{
+		}
+
+		constexpr T mid() const
+		{
+			return m;
+		}
+
+		constexpr T rad() const
+		{
+			return r;
+		}
+
+		constexpr T lower() const
+		{
+			return Trait::sub_down(m, r);
+		}
+
+		constexpr T upper() const
+		{
+			return Trait::add_up(m, r);
+		}
+
+		constexpr rinterval<T, Trait> to_rinterval() const
+		{
+			return {lower(), upper()};
+		}
+
+		explicit operator ::kv::interval<T>() const
+		{
+			return {lower(), upper()};
+		}
+
+		::kv::interval<T> to_kv() const
+		{
+			return static_cast<::kv::interval<T>>(*this);
+		}
+
+		friend ::std::ostream &operator<<(::std::ostream &os, const mrinterval &x)
+		{
+			return os << x.to_rinterval();
+		}
+
+		// <a, ra> + <b, rb> = <fl(a + b), ra + rb + |error|>
+		//
+		// on overflow the error of twosum is NaN; the sum is then formed in
+		// inf-sup form, where it is unbounded and from_infsup throws
+		friend constexpr mrinterval operator+(const mrinterval &x, const mrinterval &y)
+		{
+			auto s = Trait::twosum(x.m, y.m);
+			T rad = Trait::add_up(Trait::add_up(x.r, y.r), ::sprout::fabs(::std::get<1>(s)));
+
+			if(!finite(::std::get<0>(s)) || !finite(rad))
+				return from_pair(detail::interval_operator_add_impl1<T, Trait>(x.lower(), x.upper(), y.lower(), y.upper()));
+
+			return {::std::get<0>(s), rad};
+		}
+
+		friend constexpr mrinterval operator-(const mrinterval &x)
+		{
+			return {-x.m, x.r};
+		}
+
+		friend constexpr mrinterval operator-(const mrinterval &x, const mrinterval &y)
+		{
+			return x + -y;
+		}
+
+		// <a, ra> <b, rb> = <fl(a b), |a| rb + ra (|b| + rb) + |error|>
+		friend constexpr mrinterval operator*(const mrinterval &x, const mrinterval &y)
+		{
+			auto p = Trait::twoproduct(x.m, y.m);
+			T rad = Trait::add_up(
+				Trait::mul_up(::sprout::fabs(x.m), y.r),
+				Trait::mul_up(x.r, Trait::add_up(::sprout::fabs(y.m), y.r)));
+			rad = Trait::add_up(rad, product_error(p));
+
+			// overflow, as in operator+
+			if(!finite(::std::get<0>(p)) || !finite(rad))
+				return from_pair(detail::interval_operator_mul_impl1<T, Trait>(x.lower(), x.upper(), y.lower(), y.upper()));
+
+			return {::std::get<0>(p), rad};
+		}
+
+		friend constexpr mrinterval operator*(const mrinterval &x, const T &y)
+		{
+			auto p = Trait::twoproduct(x.m, y);
+			T rad = Trait::add_up(Trait::mul_up(x.r, ::sprout::fabs(y)), product_error(p));
+
+			if(!finite(::std::get<0>(p)) || !finite(rad))
+				return from_pair(detail::interval_operator_mul_impl2<T, Trait>(x.lower(), x.upper(), y));
+
+			return {::std::get<0>(p), rad};
+		}
+
+		friend constexpr mrinterval operator*(const T &x, const mrinterval &y)
+		{
+			return y * x;
+		}
+
+		friend constexpr mrinterval operator/(const mrinterval &x, const mrinterval &y)
+		{
+			return from_pair(detail::interval_operator_div_impl1<T, Trait>(x.lower(), x.upper(), y.lower(), y.upper()));
+		}
+
+		friend constexpr mrinterval operator/(const mrinterval &x, const T &y)
+		{
+			return from_pair(detail::interval_operator_div_impl2<T, Trait>(x.lower(), x.upper(), y));
+		}
+
+		friend constexpr mrinterval operator/(const T &x, const mrinterval &y)
+		{
+			return from_pair(detail::interval_operator_div_impl3<T, Trait>(x, y.lower(), y.upper()));
+		}
+
+		constexpr mrinterval &operator+=(const mrinterval &x)
+		{
+			return *this = *this + x;
+		}
+
+		constexpr mrinterval &operator-=(const mrinterval &x)
+		{
+			return *this = *this - x;
+		}
+
+		constexpr mrinterval &operator*=(const mrinterval &x)
+		{
+			return *this = *this * x;
+		}
+
+		constexpr mrinterval &operator/=(const mrinterval &x)
+		{
+			return *this = *this / x;
+		}
+
+		friend constexpr bool overlap(const mrinterval &x, const mrinterval &y)
+		{
+			return overlap(x.to_rinterval(), y.to_rinterval());
+		}
+	};
+
+	template <typename T>
+	struct is_mrinterval : ::std::false_type{
+	};
+
+	template <typename T, typename Trait>
+	struct is_mrinterval<mrinterval<T, Trait>> : ::std::true_type{
+	};
+
+	template <typename T>
+	constexpr bool is_mrinterval_v = is_mrinterval<T>{};
+}
@@ -11,8 +11,8 @@ namespace cti{
 		template <
 			typename Inf, typename Sup,
 			::std::enable_if_t<
-				::bcl::is_encoded_double_v<Inf>
-				&& ::bcl::is_encoded_double_v<Sup>
+				::cti::is_encoded_double<Inf>{}
+				&& ::cti::is_encoded_double<Sup>{}
 			>* = nullptr
 		>
 		constexpr auto operator,(Inf, Sup)
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cti{
+	namespace detail{
+		inline unsigned default_threads()
+		{
+			unsigned n = ::std::thread::hardware_concurrency();
+			return n == 0 ? 1 : n;
+		}
+
+		// calls f(begin, end) on contiguous chunks of [0, n), one chunk per
+		// thread.  threads == 0 uses every hardware thread.  f must not throw.
+		template <typename F>
+		void parallel_for(::std::size_t n, unsigned threads, F f)
+		{
+			if(threads == 0)
+				threads = default_threads();
+			if(threads > n)
+				threads = static_cast<unsigned>(n);
+
+			if(threads <= 1){
+				f(::std::size_t(0), n);
+				return;
+			}
+
+			::std::size_t chunk = (n + threads - 1) / threads;
+
+			::std::vector<::std::thread> workers;
+			workers.reserve(threads - 1);
+
+			for(::std::size_t begin = chunk; begin < n; begin += chunk){
+				::std::size_t end = begin + chunk < n ? begin + chunk : n;
+				workers.emplace_back(f, begin, end);
+			}
+
+			f(::std::size_t(0), chunk);
+
+			for(auto &worker : workers)
+				worker.join();
+		}
+
+		// elements per chunk of parallel_map: the input and output of a chunk
+		// fit in half of a typical 256 KiB L2 cache, and every thread gets
+		// about 16 chunks so that uneven costs are balanced
+		inline ::std::size_t parallel_map_chunk(::std::size_t n, unsigned threads, ::std::size_t bytes)
+		{
+			::std::size_t cache = (::std::size_t(128) << 10) / (bytes == 0 ? 1 : bytes);
+			::std::size_t balance = n / (::std::size_t(threads) * 16);
+			return ::std::max<::std::size_t>(1, ::std::min(cache, ::std::max<::std::size_t>(balance, 64)));
+		}
+	}
+
+	// what each thread of parallel_map did
+	struct parallel_map_stats{
+		::std::vector<::std::size_t> items;
+		::std::vector<double> seconds;
+
+		unsigned threads() const
+		{
+			return static_cast<unsigned>(items.size());
+		}
+
+		// elements per second of thread t
+		double throughput(unsigned t) const
+		{
+			return seconds[t] > 0.0 ? static_cast<double>(items[t]) / seconds[t] : 0.0;
+		}
+	};
+
+	// out[i] = f(in[i]) for i in [0, n), in parallel.  the range is cut into
+	// cache-sized chunks that the threads claim one after the other from a
+	// shared counter, so threads that finish early take over the remaining
+	// work.  threads == 0 uses every hardware thread.  the first exception
+	// thrown by f stops the other threads and is rethrown.
+	//
+	//     std::vector<cti::rinterval<double>> x = ..., y(x.size());
+	//     cti::parallel_map(x.data(), x.size(), y.data(), [](const cti::rinterval<double> &x){
+	//         return x * (1.0 - x);
+	//     });
+	template <typename T, typename U, typename F>
+	parallel_map_stats parallel_map(const T *in, ::std::size_t n, U *out, F f, unsigned threads = 0)
+	{
+		if(threads == 0)
+			threads = detail::default_threads();
+
+		::std::size_t chunk = detail::parallel_map_chunk(n, threads, sizeof(T) + sizeof(U));
+		::std::size_t chunks = (n + chunk - 1) / chunk;
+		if(threads > chunks)
+			threads = static_cast<unsigned>(chunks > 0 ? chunks : 1);
+
+		parallel_map_stats stats;
+		stats.items.assign(threads, 0);
+		stats.seconds.assign(threads, 0.0);
+
+		::std::atomic<::std::size_t> next(0);
+		::std::atomic<bool> failed(false);
+		::std::exception_ptr error;
+		::std::mutex error_mutex;
+
+		auto work = [&](unsigned t){
+			auto begin = ::std::chrono::steady_clock::now();
+			::std::size_t items = 0;
+
+			try{
+				while(!failed.load(::std::memory_order_relaxed)){
+					::std::size_t c = next.fetch_add(1, ::std::memory_order_relaxed);
+					if(c >= chunks)
+						break;
+
+					::std::size_t i0 = c * chunk, i1 = ::std::min(i0 + chunk, n);
+					for(::std::size_t i = i0; i < i1; ++i)
+						out[i] = f(in[i]);
+					items += i1 - i0;
+				}
+			}catch(...){
+				::std::lock_guard<::std::mutex> lock(error_mutex);
+				if(!error)
+					error = ::std::current_exception();
+				failed = true;
+			}
+
+			stats.items[t] = items;
+			stats.seconds[t] = ::std::chrono::duration<double>(::std::chrono::steady_clock::now() - begin).count();
+		};
+
+		::std::vector<::std::thread> workers;
+		workers.reserve(threads - 1);
+		for(unsigned t = 1; t < threads; ++t)
+			workers.emplace_back(work, t);
+
+		work(0);
+
+		for(auto &worker : workers)
+			worker.join();
+
+		if(error)
+			::std::rethrow_exception(error);
+
+		return stats;
+	}
+
+	template <typename T, typename F>
+	auto parallel_map(const ::std::vector<T> &in, F f, unsigned threads = 0, parallel_map_stats *stats = nullptr)
+		-> ::std::vector<decltype(f(in[0]))>
+	{
+		::std::vector<decltype(f(in[0]))> out(in.size());
+		auto s = parallel_map(in.data(), in.size(), out.data(), f, threads);
+		if(stats)
+			*stats = ::std::move(s);
+		return out;
+	}
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <tuple>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/rinterval.hpp>
+
+namespace cti{
+	namespace detail{
+		// a subinterval of the domain and the enclosure of f over it
+		struct range_box{
+			double inf = 0.0;
+			double sup = 0.0;
+			double lower = 0.0;
+			double upper = 0.0;
+		};
+
+		template <typename F>
+		constexpr range_box range_evaluate(const F &f, double inf, double sup)
+		{
+			rinterval<double> y = f(rinterval<double>(inf, sup));
+			return {inf, sup, y.lower(), y.upper()};
+		}
+
+		// enclosure of the range of f over [inf, sup]: f is evaluated on n
+		// equal subintervals, then `depth` times the subinterval that attains
+		// the current lower (even steps) or upper (odd steps) bound of the
+		// hull is bisected.  the boxes always cover [inf, sup], so the hull
+		// of their images is an enclosure whatever the budget.  the memory
+		// is a fixed array of N + Depth boxes, independent of f.
+		template <::std::size_t N, ::std::size_t Depth, typename F>
+		constexpr ::std::pair<double, double> range_subdivide(const F &f, double inf, double sup)
+		{
+			static_assert(N > 0, "cti::range_enclosure needs at least one subinterval");
+
+			range_box boxes[N + Depth] = {};
+
+			// adjacent boxes share the same rounded boundary
+			double left = inf;
+			for(::std::size_t i = 0; i < N; ++i){
+				double t = static_cast<double>(i + 1) / static_cast<double>(N);
+				double right = i + 1 == N ? sup : inf * (1.0 - t) + sup * t;
+				boxes[i] = range_evaluate(f, interval_operator_min(left, right), interval_operator_max(left, right));
+				left = right;
+			}
+
+			::std::size_t count = N;
+			for(::std::size_t step = 0; step < Depth; ++step){
+				::std::size_t j = 0;
+				for(::std::size_t i = 1; i < count; ++i){
+					bool better = step % 2 == 0
+						? boxes[i].lower < boxes[j].lower
+						: boxes[i].upper > boxes[j].upper;
+					if(better)
+						j = i;
+				}
+
+				double a = boxes[j].inf, b = boxes[j].sup;
+				double c = a * 0.5 + b * 0.5;
+				// a box of one or two floating-point numbers cannot be split
+				if(!(a < c && c < b))
+					continue;
+
+				boxes[j] = range_evaluate(f, a, c);
+				boxes[count++] = range_evaluate(f, c, b);
+			}
+
+			double lower = boxes[0].lower, upper = boxes[0].upper;
+			for(::std::size_t i = 1; i < count; ++i){
+				lower = interval_operator_min(lower, boxes[i].lower);
+				upper = interval_operator_max(upper, boxes[i].upper);
+			}
+
+			return {lower, upper};
+		}
+	}
+
+	// enclosure of the range of F over X, computed in a constant expression
+	// by subdivision (see detail::range_subdivide).  F is a literal function
+	// object whose constexpr operator() takes and returns rinterval<double>:
+	//
+	//     struct g{
+	//         template <typename T>
+	//         constexpr T operator()(const T &x) const
+	//         {
+	//             return x * (1.0 - x);
+	//         }
+	//     };
+	//
+	//     constexpr auto r = cti::range_enclosure<g, CTI_I(0.0, 1.0), 16, 64>();
+	//
+	// N uniform subintervals are refined by Depth bisections aimed at the
+	// bounds of the result.  the compile-time cost is N + Depth evaluations
+	// of F and the memory of N + Depth boxes; large budgets may need a
+	// higher -fconstexpr-ops-limit (gcc) or -fconstexpr-steps (clang).
+	template <typename F, typename X, ::std::size_t N = 16, ::std::size_t Depth = 0>
+	constexpr auto range_enclosure()
+	{
+		static_assert(is_interval<X>{}, "cti::range_enclosure: X must be a cti::interval");
+
+		constexpr auto result = detail::range_subdivide<N, Depth>(F{}, X{}.lower(), X{}.upper());
+
+		constexpr auto inf = detail::double_to_bits(::std::get<0>(result));
+		constexpr auto sup = detail::double_to_bits(::std::get<1>(result));
+
+		return interval<double_<inf>, double_<sup>>{};
+	}
+
+	template <typename F, typename X, ::std::size_t N = 16, ::std::size_t Depth = 0>
+	using range_enclosure_t = decltype(range_enclosure<F, X, N, Depth>());
+}
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <ostream>
+#include <utility>
+#include <tuple>
+#include <type_traits>
+
+#include <kv/interval.hpp>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+
+namespace cti{
+	// interval whose bounds are values instead of types
+	//
+	// the operators call the same detail::interval_operator_*_impl functions
+	// as cti::interval, so they never change the rounding mode and can be
+	// used both in constant expressions and at run time.  a cti::interval
+	// converts implicitly to rinterval.
+	//
+	//     constexpr cti::rinterval<double> x = CTI_I(0.1, 0.2){};
+	//     cti::rinterval<double> y = x * 3.0 + x;
+	//
+	// Trait may be replaced by a runtime-only trait such as cti::runtime_trait
+	// (cti/fma.hpp) for hot loops.
+	template <typename T, typename Trait = trait<T>>
+	class rinterval{
+		T inf;
+		T sup;
+
+		static constexpr rinterval from_pair(const ::std::pair<T, T> &x)
+		{
+			return {::std::get<0>(x), ::std::get<1>(x)};
+		}
+
+	public:
+		using value_type = T;
+		using trait_type = Trait;
+
+		constexpr rinterval()
+			: inf(0.0), sup(0.0)
+		{
+		}
+
+		constexpr rinterval(const T &x)
+			: inf(x), sup(x)
+		{
+		}
+
+		constexpr rinterval(const T &inf, const T &sup)
+			: inf(inf), sup(sup)
+		{
+		}
+
+		// the bounds stay valid, only the rounding of later operations changes
+		template <typename Trait2>
+		constexpr rinterval(const rinterval<T, Trait2> &x)
+			: inf(x.lower()), sup(x.upper())
+		{
+		}
+
+		template <typename Inf, typename Sup>
+		constexpr rinterval(interval<Inf, Sup>)
+			: inf(Inf::value), sup(Sup::value)
+		{
+		}
+
+		using kv_type = typename detail::bound<T>::kv_type;
+
+		explicit operator ::kv::interval<kv_type>() const
+		{
+			return {detail::bound<T>::to_kv(inf), detail::bound<T>::to_kv(sup)};
+		}
+
+		::kv::interval<kv_type> to_kv() const
+		{
+			return static_cast<::kv::interval<kv_type>>(*this);
+		}
+
+		constexpr T lower() const
+		{
+			return inf;
+		}
+
+		constexpr T upper() const
+		{
+			return sup;
+		}
+
+		friend ::std::ostream &operator<<(::std::ostream &os, const rinterval &x)
+		{
+			os << '[';
+			Trait::print_down(x.inf, os);
+			os << ',';
+			Trait::print_up(x.sup, os);
+			os << ']';
+			return os;
+		}
+
+		friend constexpr rinterval operator+(const rinterval &x, const rinterval &y)
+		{
+			return from_pair(detail::interval_operator_add_impl1<T, Trait>(x.inf, x.sup, y.inf, y.sup));
+		}
+
+		friend constexpr rinterval operator-(const rinterval &x, const rinterval &y)
+		{
+			return from_pair(detail::interval_operator_sub_impl1<T, Trait>(x.inf, x.sup, y.inf, y.sup));
+		}
+
+		friend constexpr rinterval operator-(const rinterval &x)
+		{
+			return {-x.sup, -x.inf};
+		}
+
+		friend constexpr rinterval operator*(const rinterval &x, const rinterval &y)
+		{
+			return from_pair(detail::interval_operator_mul_impl1<T, Trait>(x.inf, x.sup, y.inf, y.sup));
+		}
+
+		friend constexpr rinterval operator*(const rinterval &x, const T &y)
+		{
+			return from_pair(detail::interval_operator_mul_impl2<T, Trait>(x.inf, x.sup, y));
+		}
+
+		friend constexpr rinterval operator*(const T &x, const rinterval &y)
+		{
+			return y * x;
+		}
+
+		friend constexpr rinterval operator/(const rinterval &x, const rinterval &y)
+		{
+			return from_pair(detail::interval_operator_div_impl1<T, Trait>(x.inf, x.sup, y.inf, y.sup));
+		}
+
+		friend constexpr rinterval operator/(const rinterval &x, const T &y)
+		{
+			return from_pair(detail::interval_operator_div_impl2<T, Trait>(x.inf, x.sup, y));
+		}
+
+		friend constexpr rinterval operator/(const T &x, const rinterval &y)
+		{
+			return from_pair(detail::interval_operator_div_impl3<T, Trait>(x, y.inf, y.sup));
+		}
+
+		constexpr rinterval &operator+=(const rinterval &x)
+		{
+			return *this = *this + x;
+		}
+
+		constexpr rinterval &operator-=(const rinterval &x)
+		{
+			return *this = *this - x;
+		}
+
+		constexpr rinterval &operator*=(const rinterval &x)
+		{
+			return *this = *this * x;
+		}
+
+		constexpr rinterval &operator/=(const rinterval &x)
+		{
+			return *this = *this / x;
+		}
+
+		// comparisons have the same meaning as those of cti::interval
+		friend constexpr bool operator<(const rinterval &x, const rinterval &y)
+		{
+			return x.sup < y.inf;
+		}
+
+		friend constexpr bool operator<=(const rinterval &x, const rinterval &y)
+		{
+			return x.sup <= y.inf;
+		}
+
+		friend constexpr bool operator>(const rinterval &x, const rinterval &y)
+		{
+			return x.inf > y.sup;
+		}
+
+		friend constexpr bool operator>=(const rinterval &x, const rinterval &y)
+		{
+			return x.inf >= y.sup;
+		}
+
+		friend constexpr bool operator==(const rinterval &x, const rinterval &y)
+		{
+			return x.inf == x.sup
+				&& x.sup == y.inf
+				&& y.inf == y.sup;
+		}
+
+		friend constexpr bool operator!=(const rinterval &x, const rinterval &y)
+		{
+			return !overlap(x, y);
+		}
+
+		friend constexpr bool overlap(const rinterval &x, const rinterval &y)
+		{
+			return detail::interval_operator_max(x.inf, y.inf) <= detail::interval_operator_min(x.sup, y.sup);
+		}
+
+		friend constexpr rinterval sqrt(const rinterval &x)
+		{
+			return from_pair(detail::interval_sqrt_impl<T, Trait>(x.inf, x.sup));
+		}
+
+		friend constexpr rinterval abs(const rinterval &x)
+		{
+			return from_pair(detail::interval_abs_impl<T>(x.inf, x.sup));
+		}
+
+		template <typename I, ::std::enable_if_t<::std::is_integral<I>{}>* = nullptr>
+		friend constexpr rinterval pow(const rinterval &x, I n)
+		{
+			return from_pair(detail::interval_pow_int_impl<T, Trait>(x.inf, x.sup, static_cast<int>(n)));
+		}
+
+		friend constexpr rinterval square(const rinterval &x)
+		{
+			return pow(x, 2);
+		}
+	};
+
+	template <typename T>
+	struct is_rinterval : ::std::false_type{
+	};
+
+	template <typename T, typename Trait>
+	struct is_rinterval<rinterval<T, Trait>> : ::std::true_type{
+	};
+
+	template <typename T>
+	constexpr bool is_rinterval_v = is_rinterval<T>{};
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <utility>
+#include <tuple>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/rinterval.hpp>
+
+namespace cti{
+	// value and derivative of a function, propagated by forward-mode
+	// automatic differentiation.  the generic function objects given to
+	// verify_root are called with dual<rinterval<double>> to obtain an
+	// enclosure of the derivative.
+	template <typename T>
+	struct dual{
+		using value_type = T;
+
+		T v;
+		T d;
+
+		constexpr dual()
+			: v(0.0), d(0.0)
+		{
+		}
+
+		constexpr dual(const T &v)
+			: v(v), d(0.0)
+		{
+		}
+
+		constexpr dual(const T &v, const T &d)
+			: v(v), d(d)
+		{
+		}
+
+		constexpr dual(double x)
+			: v(x), d(0.0)
+		{
+		}
+
+		friend constexpr dual operator+(const dual &x, const dual &y)
+		{
+			return {x.v + y.v, x.d + y.d};
+		}
+
+		friend constexpr dual operator-(const dual &x, const dual &y)
+		{
+			return {x.v - y.v, x.d - y.d};
+		}
+
+		friend constexpr dual operator-(const dual &x)
+		{
+			return {-x.v, -x.d};
+		}
+
+		friend constexpr dual operator*(const dual &x, const dual &y)
+		{
+			return {x.v * y.v, x.d * y.v + x.v * y.d};
+		}
+
+		friend constexpr dual operator/(const dual &x, const dual &y)
+		{
+			return {x.v / y.v, (x.d * y.v - x.v * y.d) / (y.v * y.v)};
+		}
+
+		friend constexpr dual sqrt(const dual &x)
+		{
+			T r = sqrt(x.v);
+			return {r, x.d / (2.0 * r)};
+		}
+
+		friend constexpr dual pow(const dual &x, int n)
+		{
+			return n == 0
+				? dual(1.0)
+				: dual(pow(x.v, n), static_cast<double>(n) * pow(x.v, n - 1) * x.d);
+		}
+
+		friend constexpr dual square(const dual &x)
+		{
+			return pow(x, 2);
+		}
+	};
+
+	namespace detail{
+		struct root_result{
+			bool verified;
+			double inf;
+			double sup;
+		};
+
+		// krawczyk's method for a root of f in [inf, sup]:
+		//
+		//     K(X) = c - y f(c) + (1 - y f'(X)) (X - c),  c = mid X, y ~ 1 / f'(c)
+		//
+		// every root in X lies in K(X), and K(X) in the interior of X proves
+		// that X contains exactly one root.  the iteration continues with
+		// K(X) & X until the enclosure stops shrinking.
+		template <typename F>
+		constexpr root_result root_krawczyk(const F &f, double inf, double sup, int iterations)
+		{
+			using I = rinterval<double>;
+
+			bool verified = false;
+
+			for(int i = 0; i < iterations; ++i){
+				double c = inf * 0.5 + sup * 0.5;
+
+				I fc = f(I(c));
+				I df = f(dual<I>(I(inf, sup), I(1.0))).d;
+
+				double m = df.lower() * 0.5 + df.upper() * 0.5;
+				if(m == 0.0)
+					break;
+
+				double y = 1.0 / m;
+				I k = c - y * fc + (1.0 - y * df) * (I(inf, sup) - c);
+
+				if(k.lower() > inf && k.upper() < sup)
+					verified = true;
+
+				double next_inf = interval_operator_max(k.lower(), inf);
+				double next_sup = interval_operator_min(k.upper(), sup);
+
+				// no root in X
+				if(next_inf > next_sup)
+					return {false, inf, sup};
+
+				if(verified && next_inf == inf && next_sup == sup)
+					break;
+
+				inf = next_inf;
+				sup = next_sup;
+			}
+
+			return {verified, inf, sup};
+		}
+	}
+
+	// tight enclosure of the unique root of F in X0, computed and verified
+	// with krawczyk's method in a constant expression.  F is a literal
+	// function object with a generic constexpr operator(), which is called
+	// with rinterval<double> and with dual<rinterval<double>>:
+	//
+	//     struct sqrt2{
+	//         template <typename T>
+	//         constexpr T operator()(const T &x) const
+	//         {
+	//             return x * x - 2.0;
+	//         }
+	//     };
+	//
+	//     constexpr auto r = cti::verify_root<sqrt2, CTI_I(1.0, 2.0)>();
+	//
+	// compilation fails if the existence and uniqueness of the root cannot
+	// be proven within Iterations steps.
+	template <typename F, typename X0, int Iterations = 64>
+	constexpr auto verify_root()
+	{
+		static_assert(is_interval<X0>{}, "cti::verify_root: X0 must be a cti::interval");
+
+		constexpr auto result = detail::root_krawczyk(F{}, X0{}.lower(), X0{}.upper(), Iterations);
+
+		static_assert(result.verified, "cti::verify_root: no unique root could be verified in X0");
+
+		constexpr auto inf = detail::double_to_bits(result.inf);
+		constexpr auto sup = detail::double_to_bits(result.sup);
+
+		return interval<double_<inf>, double_<sup>>{};
+	}
+
+	template <typename F, typename X0>
+	constexpr auto verify_root(X0)
+	{
+		return verify_root<F, X0>();
+	}
+
+	template <typename F, typename X0, int Iterations = 64>
+	using verify_root_t = decltype(verify_root<F, X0, Iterations>());
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <limits>
+
+#include <bcl/math/sqrt.hpp>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+
+namespace cti{
+	// variant of trait<double> that rounds every result to nearest and then
+	// moves it one ulp outward with succ/pred, without the error-free
+	// transformations.  it is cheaper than trait<double> but the bound is
+	// one ulp wider whenever the result was exact or rounded outward
+	// already.  succ/pred of a result rounded to nearest always enclose the
+	// exact value, so the bounds stay rigorous.
+	//
+	// use it where throughput matters more than tightness, e.g.
+	// rinterval<double, rough_trait> or the Trait parameter of the
+	// detail::interval_operator_*_impl functions.
+	struct rough_trait : trait<double>{
+		static constexpr double up(double r, double x, double y)
+		{
+			constexpr double inf = ::std::numeric_limits<double>::infinity();
+
+			// an overflow to -inf rounds up to -max unless an operand is -inf
+			if(r == -inf)
+				return x == -inf || y == -inf ? r : -::std::numeric_limits<double>::max();
+
+			return succ(r);
+		}
+
+		static constexpr double down(double r, double x, double y)
+		{
+			constexpr double inf = ::std::numeric_limits<double>::infinity();
+
+			if(r == inf)
+				return x == inf || y == inf ? r : ::std::numeric_limits<double>::max();
+
+			return pred(r);
+		}
+
+		static constexpr double add_up(double x, double y)
+		{
+			return up(x + y, x, y);
+		}
+
+		static constexpr double add_down(double x, double y)
+		{
+			return down(x + y, x, y);
+		}
+
+		static constexpr double sub_up(double x, double y)
+		{
+			return up(x - y, x, -y);
+		}
+
+		static constexpr double sub_down(double x, double y)
+		{
+			return down(x - y, x, -y);
+		}
+
+		static constexpr double mul_up(double x, double y)
+		{
+			constexpr double inf = ::std::numeric_limits<double>::infinity();
+
+			double r = x * y;
+			if(r == -inf)
+				return x == -inf || y == -inf || x == inf || y == inf ? r : -::std::numeric_limits<double>::max();
+
+			return succ(r);
+		}
+
+		static constexpr double mul_down(double x, double y)
+		{
+			constexpr double inf = ::std::numeric_limits<double>::infinity();
+
+			double r = x * y;
+			if(r == inf)
+				return x == -inf || y == -inf || x == inf || y == inf ? r : ::std::numeric_limits<double>::max();
+
+			return pred(r);
+		}
+
+		static constexpr double div_up(double x, double y)
+		{
+			constexpr double inf = ::std::numeric_limits<double>::infinity();
+
+			double r = x / y;
+			if(r == -inf)
+				return x == -inf || x == inf ? r : -::std::numeric_limits<double>::max();
+
+			return succ(r);
+		}
+
+		static constexpr double div_down(double x, double y)
+		{
+			constexpr double inf = ::std::numeric_limits<double>::infinity();
+
+			double r = x / y;
+			if(r == inf)
+				return x == -inf || x == inf ? r : ::std::numeric_limits<double>::max();
+
+			return pred(r);
+		}
+
+		static constexpr double sqrt_up(double x)
+		{
+			constexpr double inf = ::std::numeric_limits<double>::infinity();
+
+			double r = ::bcl::sqrt(x);
+			return r == inf ? r : succ(r);
+		}
+
+		static constexpr double sqrt_down(double x)
+		{
+			constexpr double inf = ::std::numeric_limits<double>::infinity();
+
+			double r = ::bcl::sqrt(x);
+			return r == 0.0 || r == inf ? r : pred(r);
+		}
+	};
+}
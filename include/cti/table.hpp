@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include <bcl/double.hpp>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/rinterval.hpp>
+
+namespace cti{
+	// compile-time table of N verified constants.  the entries are
+	// values[i] = F{}(i), where F is a literal function object whose
+	// constexpr operator() returns a rinterval<double> (or anything that
+	// converts to it, such as cti::interval).  the table is evaluated once
+	// per (N, F) and stored as a constexpr std::array of {lower, upper}
+	// pairs, so it costs no interval<Inf, Sup> type per entry; get<I>()
+	// encodes a single entry as a type when one is needed.
+	//
+	//     struct reciprocal{
+	//         constexpr cti::rinterval<double> operator()(std::size_t k) const
+	//         {
+	//             return 1.0 / cti::rinterval<double>(k + 1.0);
+	//         }
+	//     };
+	//
+	//     using reciprocals = cti::table<100, reciprocal>;
+	//     constexpr cti::rinterval<double> x = reciprocals::values[9];  // 1/10
+	//     constexpr auto y = reciprocals::get<9>();                      // cti::interval
+	template <::std::size_t N, typename F>
+	class table{
+		template <::std::size_t ... Is>
+		static constexpr ::std::array<rinterval<double>, N> generate(::std::index_sequence<Is...>)
+		{
+			return {{rinterval<double>(F{}(Is))...}};
+		}
+
+	public:
+		using value_type = rinterval<double>;
+
+		static constexpr ::std::array<rinterval<double>, N> values = generate(::std::make_index_sequence<N>{});
+
+		static constexpr ::std::size_t size()
+		{
+			return N;
+		}
+
+		static constexpr rinterval<double> at(::std::size_t i)
+		{
+			return values[i];
+		}
+
+		template <::std::size_t I>
+		static constexpr auto get()
+		{
+			static_assert(I < N, "cti::table: index out of range");
+
+			constexpr auto inf = detail::double_to_bits(values[I].lower());
+			constexpr auto sup = detail::double_to_bits(values[I].upper());
+
+			return interval<double_<inf>, double_<sup>>{};
+		}
+	};
+
+	template <::std::size_t N, typename F>
+	constexpr ::std::array<rinterval<double>, N> table<N, F>::values;
+}
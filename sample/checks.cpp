@@ -0,0 +1,78 @@
+// enclosure checks of edge cases against libm and exact values.  every
+// line prints the interval and the reference value; the exit status is
+// the number of failures.
+//
+//     g++ -std=c++14 -ffp-contract=off -Iinclude sample/checks.cpp
+
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+#include <cti/interval.hpp>
+#include <cti/rdouble.hpp>
+#include <cti/math.hpp>
+#include <cti/mrinterval.hpp>
+
+namespace{
+	int failures = 0;
+
+	template <typename I>
+	void check(const char *name, I x, double reference)
+	{
+		bool ok = x.lower() <= reference && reference <= x.upper();
+		if(!ok)
+			++failures;
+
+		std::cout << (ok ? "ok   " : "FAIL ") << name << ": " << x << " contains " << reference << std::endl;
+	}
+
+	template <typename I>
+	void check(const char *name, I x, double lower, double upper)
+	{
+		check(name, x, lower);
+		check(name, x, upper);
+	}
+
+	template <typename F>
+	void check_throws(const char *name, F f)
+	{
+		bool ok = false;
+		try{
+			f();
+		}catch(const std::domain_error &){
+			ok = true;
+		}
+		if(!ok)
+			++failures;
+
+		std::cout << (ok ? "ok   " : "FAIL ") << name << ": throws std::domain_error" << std::endl;
+	}
+}
+
+int main()
+{
+	std::cout.setf(std::ios::scientific);
+	std::cout.precision(16);
+
+	// just below log(max) = 709.782712893384
+	check("exp(709.781)", cti::exp(CTI_I(709.781){}), std::exp(709.781));
+	check("exp(709.7827)", cti::exp(CTI_I(709.7827){}), std::exp(709.7827));
+	check("exp(709.5)", cti::exp(CTI_I(709.5){}), std::exp(709.5));
+
+	// scalar minus interval: 1 - [0, 2] = [-1, 1]
+	check("1 - [0,2]", CTI_I(1.0){} - CTI_I(0.0, 2.0){}, -1.0, 1.0);
+	check("1 - [0,2] (scalar)", CTI_DOUBLE(1.0){} - CTI_I(0.0, 2.0){}, -1.0, 1.0);
+
+	// mid(x) - x contains 0
+	constexpr auto x = CTI_I(0.1, 0.7){};
+	check("mid(x) - x", cti::mid(x) - x, 0.0);
+
+	// midpoint-radius sums and products that overflow are unbounded
+	using mri = cti::mrinterval<double>;
+	check_throws("<1e308> + <1e308>", []{ return mri(1e308) + mri(1e308); });
+	check_throws("<1e200> * <1e200>", []{ return mri(1e200) * mri(1e200); });
+	check_throws("<1e200> * 1e200", []{ return mri(1e200) * 1e200; });
+	check("<1e305> * <1e-5>", (mri(1e305) * mri(1e-5)).to_rinterval(), 1e300);
+
+	return failures;
+}